@@ -0,0 +1,240 @@
+// A minimal micro-benchmark harness in the style of Google Benchmark,
+// usable with C++98 and later.
+//
+// https://github.com/martinmoene/span-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#ifndef BENCH_SPAN_LITE_H_INCLUDED
+#define BENCH_SPAN_LITE_H_INCLUDED
+
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if __cplusplus >= 201103L || ( defined(_MSVC_LANG) && _MSVC_LANG >= 201103L )
+# define bench_CPP11_OR_GREATER  1
+# include <chrono>
+#elif defined(_WIN32)
+# define bench_CPP11_OR_GREATER  0
+# include <ctime>
+#else
+# define bench_CPP11_OR_GREATER  0
+# include <sys/time.h>
+#endif
+
+#if defined(_MSC_VER)
+# include <intrin.h>
+#endif
+
+// Usage:
+//
+//     static void BM_name( bench::state & state )
+//     {
+//         // setup
+//         while ( state.keep_running() )
+//         {
+//             // code to measure
+//         }
+//     }
+//     BENCHMARK( BM_name );
+//
+//     int main( int argc, char * argv[] ) { return bench::run( argc, argv ); }
+
+namespace bench {
+
+// Prevent the compiler from optimizing away a value or pending stores:
+
+#if defined(__GNUC__) || defined(__clang__)
+
+template< typename T >
+inline void do_not_optimize( T const & value )
+{
+    asm volatile( "" : : "r,m"( value ) : "memory" );
+}
+
+inline void clobber_memory()
+{
+    asm volatile( "" : : : "memory" );
+}
+
+#else
+
+inline void use_char_pointer( char const volatile * ) {}
+
+template< typename T >
+inline void do_not_optimize( T const & value )
+{
+    use_char_pointer( &reinterpret_cast< char const volatile & >( value ) );
+}
+
+inline void clobber_memory()
+{
+#if defined(_MSC_VER)
+    _ReadWriteBarrier();
+#endif
+}
+
+#endif
+
+// Wall-clock time in seconds (C++98 on Windows: std::clock(), which the
+// Windows C runtime implements as elapsed wall-clock time):
+
+inline double now()
+{
+#if bench_CPP11_OR_GREATER
+    return std::chrono::duration< double >( std::chrono::steady_clock::now().time_since_epoch() ).count();
+#elif defined(_WIN32)
+    return static_cast< double >( std::clock() ) / CLOCKS_PER_SEC;
+#else
+    timeval tv;
+    ::gettimeofday( &tv, 0 );
+    return static_cast< double >( tv.tv_sec ) + static_cast< double >( tv.tv_usec ) * 1e-6;
+#endif
+}
+
+// Benchmark state, passed to each benchmark function:
+
+class state
+{
+public:
+    explicit state( long iterations )
+        : iterations_( iterations )
+        , remaining_( iterations )
+        , start_( 0 )
+        , stop_( 0 )
+        , items_( 0 )
+    {}
+
+    bool keep_running()
+    {
+        if ( remaining_ == iterations_ )
+        {
+            start_ = now();
+        }
+        if ( remaining_-- > 0 )
+        {
+            return true;
+        }
+        stop_ = now();
+        return false;
+    }
+
+    long iterations() const
+    {
+        return iterations_;
+    }
+
+    double elapsed() const
+    {
+        return stop_ - start_;
+    }
+
+    void set_items_processed( double items )
+    {
+        items_ = items;
+    }
+
+    double items_processed() const
+    {
+        return items_;
+    }
+
+private:
+    long   iterations_;
+    long   remaining_;
+    double start_;
+    double stop_;
+    double items_;
+};
+
+typedef void (*function)( state & );
+
+struct benchmark
+{
+    char const * name;
+    function     fn;
+};
+
+inline std::vector< benchmark > & registry()
+{
+    static std::vector< benchmark > benchmarks;
+    return benchmarks;
+}
+
+struct registrar
+{
+    registrar( char const * name, function fn )
+    {
+        benchmark b = { name, fn };
+        registry().push_back( b );
+    }
+};
+
+// Run each benchmark with a growing number of iterations until it takes at least min_time seconds:
+
+inline int run( int argc, char * argv[] )
+{
+    double      min_time = 0.2;
+    std::string filter;
+
+    for ( int i = 1; i < argc; ++i )
+    {
+        std::string arg = argv[i];
+
+        if      ( arg.compare( 0, 11, "--min-time=" ) == 0 ) { min_time = std::atof( arg.c_str() + 11 ); }
+        else if ( arg.compare( 0,  9, "--filter="   ) == 0 ) { filter   = arg.substr( 9 ); }
+        else
+        {
+            std::cerr << "Usage: " << argv[0] << " [--filter=substring] [--min-time=seconds]\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::cout << std::left << std::setw( 44 ) << "Benchmark" << std::right
+              << std::setw( 14 ) << "Time (ns)" << std::setw( 14 ) << "Iterations" << std::setw( 16 ) << "Items/s" << "\n"
+              << std::string( 88, '-' ) << "\n";
+
+    for ( std::vector< benchmark >::const_iterator pos = registry().begin(); pos != registry().end(); ++pos )
+    {
+        if ( ! filter.empty() && std::string( pos->name ).find( filter ) == std::string::npos )
+        {
+            continue;
+        }
+
+        for ( long iterations = 1; ; iterations *= 10 )
+        {
+            state s( iterations );
+            pos->fn( s );
+
+            if ( s.elapsed() >= min_time || iterations >= 1000000000L )
+            {
+                std::cout << std::left  << std::setw( 44 ) << pos->name << std::right << std::fixed << std::setprecision( 2 )
+                          << std::setw( 14 ) << 1e9 * s.elapsed() / static_cast< double >( iterations )
+                          << std::setw( 14 ) << iterations
+                          << std::setw( 16 ) << std::setprecision( 0 ) << s.items_processed() / s.elapsed()
+                          << "\n";
+                break;
+            }
+        }
+    }
+    return EXIT_SUCCESS;
+}
+
+} // namespace bench
+
+#define bench_CONCAT_( a, b )  a ## b
+#define bench_CONCAT(  a, b )  bench_CONCAT_( a, b )
+
+#define BENCHMARK( fn ) \
+    static bench::registrar bench_CONCAT( bench_registrar_, __LINE__ )( #fn, fn )
+
+#endif // BENCH_SPAN_LITE_H_INCLUDED
+
+// end of file
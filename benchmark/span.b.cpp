@@ -0,0 +1,451 @@
+// Micro-benchmarks of span operations against raw pointers and std::span.
+//
+// https://github.com/martinmoene/span-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "nonstd/span.hpp"
+#include "bench.hpp"
+
+#include <algorithm>
+#include <sstream>
+#include <vector>
+
+#if !span_USES_STD_SPAN && span_HAVE( STD_SPAN )
+# include <span>
+# define bench_HAVE_STD_SPAN  1
+#else
+# define bench_HAVE_STD_SPAN  0
+#endif
+
+namespace {
+
+const std::size_t N = 4096;
+const std::size_t W = 16;
+
+std::vector<int> & data()
+{
+    static std::vector<int> v( N, 1 );
+    return v;
+}
+
+std::vector<int> & other()
+{
+    static std::vector<int> v( N, 1 );
+    return v;
+}
+
+// Indexing: sum via operator[]:
+
+void raw_index( bench::state & state )
+{
+    int const * ptr = &data()[0];
+    std::size_t size = data().size();
+
+    while ( state.keep_running() )
+    {
+        int sum = 0;
+        for ( std::size_t i = 0; i < size; ++i )
+            sum += ptr[i];
+        bench::do_not_optimize( sum );
+    }
+    state.set_items_processed( static_cast<double>( state.iterations() ) * static_cast<double>( N ) );
+}
+
+void span_index( bench::state & state )
+{
+    nonstd::span<int const> spn( &data()[0], data().size() );
+
+    while ( state.keep_running() )
+    {
+        int sum = 0;
+        for ( std::size_t i = 0; i < spn.size(); ++i )
+            sum += spn[i];
+        bench::do_not_optimize( sum );
+    }
+    state.set_items_processed( static_cast<double>( state.iterations() ) * static_cast<double>( N ) );
+}
+
+// Iteration: sum via begin(), end():
+
+void raw_iterate( bench::state & state )
+{
+    int const * first = &data()[0];
+    int const * last  = first + data().size();
+
+    while ( state.keep_running() )
+    {
+        int sum = 0;
+        for ( int const * pos = first; pos != last; ++pos )
+            sum += *pos;
+        bench::do_not_optimize( sum );
+    }
+    state.set_items_processed( static_cast<double>( state.iterations() ) * static_cast<double>( N ) );
+}
+
+void span_iterate( bench::state & state )
+{
+    nonstd::span<int const> spn( &data()[0], data().size() );
+
+    while ( state.keep_running() )
+    {
+        int sum = 0;
+        for ( nonstd::span<int const>::iterator pos = spn.begin(); pos != spn.end(); ++pos )
+            sum += *pos;
+        bench::do_not_optimize( sum );
+    }
+    state.set_items_processed( static_cast<double>( state.iterations() ) * static_cast<double>( N ) );
+}
+
+// Sub views: sum of W-element windows via subspan():
+
+void raw_subspan( bench::state & state )
+{
+    int const * ptr = &data()[0];
+
+    while ( state.keep_running() )
+    {
+        int sum = 0;
+        for ( std::size_t offset = 0; offset + W <= N; offset += W )
+        {
+            int const * sub = ptr + offset;
+            for ( std::size_t i = 0; i < W; ++i )
+                sum += sub[i];
+        }
+        bench::do_not_optimize( sum );
+    }
+    state.set_items_processed( static_cast<double>( state.iterations() ) * static_cast<double>( N ) );
+}
+
+void span_subspan( bench::state & state )
+{
+    nonstd::span<int const> spn( &data()[0], data().size() );
+
+    while ( state.keep_running() )
+    {
+        int sum = 0;
+        for ( std::size_t offset = 0; offset + W <= spn.size(); offset += W )
+        {
+            nonstd::span<int const> sub = spn.subspan( offset, W );
+            for ( std::size_t i = 0; i < sub.size(); ++i )
+                sum += sub[i];
+        }
+        bench::do_not_optimize( sum );
+    }
+    state.set_items_processed( static_cast<double>( state.iterations() ) * static_cast<double>( N ) );
+}
+
+// Comparison: equality of two sequences:
+
+void raw_compare( bench::state & state )
+{
+    int const * a = &data()[0];
+    int const * b = &other()[0];
+
+    while ( state.keep_running() )
+    {
+        bool equal = std::equal( a, a + N, b );
+        bench::do_not_optimize( equal );
+        bench::clobber_memory();
+    }
+    state.set_items_processed( static_cast<double>( state.iterations() ) * static_cast<double>( N ) );
+}
+
+#if !span_USES_STD_SPAN && span_FEATURE( COMPARISON )
+
+void span_compare( bench::state & state )
+{
+    nonstd::span<int const> a( &data()[0], data().size() );
+    nonstd::span<int const> b( &other()[0], other().size() );
+
+    while ( state.keep_running() )
+    {
+        bool equal = a == b;
+        bench::do_not_optimize( equal );
+        bench::clobber_memory();
+    }
+    state.set_items_processed( static_cast<double>( state.iterations() ) * static_cast<double>( N ) );
+}
+
+#endif
+
+// Construction from a container:
+
+void raw_from_container( bench::state & state )
+{
+    std::vector<int> & vec = data();
+
+    while ( state.keep_running() )
+    {
+        int const * ptr  = vec.empty() ? 0 : &vec[0];
+        std::size_t size = vec.size();
+        bench::do_not_optimize( ptr );
+        bench::do_not_optimize( size );
+        bench::clobber_memory();
+    }
+    state.set_items_processed( static_cast<double>( state.iterations() ) );
+}
+
+void span_from_container( bench::state & state )
+{
+    std::vector<int> & vec = data();
+
+    while ( state.keep_running() )
+    {
+#if span_HAVE( CONSTRAINED_SPAN_CONTAINER_CTOR )
+        nonstd::span<int const> spn( vec );
+#else
+        nonstd::span<int const> spn( vec.empty() ? 0 : &vec[0], vec.size() );
+#endif
+        bench::do_not_optimize( spn );
+        bench::clobber_memory();
+    }
+    state.set_items_processed( static_cast<double>( state.iterations() ) );
+}
+
+// Byte access: sum of the object representation via as_bytes():
+
+#if !span_USES_STD_SPAN && ( span_HAVE( BYTE ) || span_HAVE( NONSTD_BYTE ) )
+
+void raw_as_bytes( bench::state & state )
+{
+    unsigned char const * ptr = reinterpret_cast<unsigned char const *>( &data()[0] );
+    std::size_t size = data().size() * sizeof( int );
+
+    while ( state.keep_running() )
+    {
+        unsigned sum = 0;
+        for ( std::size_t i = 0; i < size; ++i )
+            sum += ptr[i];
+        bench::do_not_optimize( sum );
+    }
+    state.set_items_processed( static_cast<double>( state.iterations() ) * static_cast<double>( N * sizeof( int ) ) );
+}
+
+void span_as_bytes( bench::state & state )
+{
+    nonstd::span<int const> spn( &data()[0], data().size() );
+
+    while ( state.keep_running() )
+    {
+        nonstd::span<const nonstd::span_lite::std17::byte> bytes = nonstd::as_bytes( spn );
+
+        unsigned sum = 0;
+        for ( std::size_t i = 0; i < bytes.size(); ++i )
+            sum += static_cast<unsigned char>( bytes[i] );
+        bench::do_not_optimize( sum );
+    }
+    state.set_items_processed( static_cast<double>( state.iterations() ) * static_cast<double>( N * sizeof( int ) ) );
+}
+
+#endif
+
+// Bits: count the set bits of a bitmap, bit by bit and via bit_span:
+
+#if !span_USES_STD_SPAN && span_FEATURE( BIT_SPAN )
+
+std::vector<unsigned long> & bitmap()
+{
+    static std::vector<unsigned long> v( N, 0x5555UL );
+    return v;
+}
+
+const std::size_t bits_per_word = sizeof( unsigned long ) * 8;
+
+void raw_bit_count( bench::state & state )
+{
+    unsigned long const * ptr = &bitmap()[0];
+    std::size_t size = bitmap().size() * bits_per_word;
+
+    while ( state.keep_running() )
+    {
+        std::size_t count = 0;
+        for ( std::size_t i = 0; i < size; ++i )
+            count += ( ptr[ i / bits_per_word ] >> ( i % bits_per_word ) ) & 1u;
+        bench::do_not_optimize( count );
+    }
+    state.set_items_processed( static_cast<double>( state.iterations() ) * static_cast<double>( N * bits_per_word ) );
+}
+
+void span_bit_count( bench::state & state )
+{
+    nonstd::span<unsigned long const> words( &bitmap()[0], bitmap().size() );
+    nonstd::bit_span<unsigned long const> bits( words );
+
+    while ( state.keep_running() )
+    {
+        std::size_t count = bits.count();
+        bench::do_not_optimize( count );
+    }
+    state.set_items_processed( static_cast<double>( state.iterations() ) * static_cast<double>( N * bits_per_word ) );
+}
+
+#endif
+
+// Format: format a log line via std::ostringstream and into a fixed buffer via ospanstream:
+
+#if !span_USES_STD_SPAN && span_FEATURE( SPANSTREAM )
+
+void raw_format( bench::state & state )
+{
+    while ( state.keep_running() )
+    {
+        std::ostringstream os;
+        os << "request " << state.iterations() << " took " << 42 << " us";
+        bench::do_not_optimize( os.str().size() );
+    }
+    state.set_items_processed( static_cast<double>( state.iterations() ) );
+}
+
+void span_format( bench::state & state )
+{
+    char buffer[64];
+
+    while ( state.keep_running() )
+    {
+        nonstd::ospanstream os( ( nonstd::span<char>( buffer ) ) );
+        os << "request " << state.iterations() << " took " << 42 << " us";
+        bench::do_not_optimize( os.span().size() );
+    }
+    state.set_items_processed( static_cast<double>( state.iterations() ) );
+}
+
+#endif
+
+// std::span, if available in addition to nonstd::span:
+
+#if bench_HAVE_STD_SPAN
+
+void std_span_index( bench::state & state )
+{
+    std::span<int const> spn( data() );
+
+    while ( state.keep_running() )
+    {
+        int sum = 0;
+        for ( std::size_t i = 0; i < spn.size(); ++i )
+            sum += spn[i];
+        bench::do_not_optimize( sum );
+    }
+    state.set_items_processed( static_cast<double>( state.iterations() ) * static_cast<double>( N ) );
+}
+
+void std_span_iterate( bench::state & state )
+{
+    std::span<int const> spn( data() );
+
+    while ( state.keep_running() )
+    {
+        int sum = 0;
+        for ( int x : spn )
+            sum += x;
+        bench::do_not_optimize( sum );
+    }
+    state.set_items_processed( static_cast<double>( state.iterations() ) * static_cast<double>( N ) );
+}
+
+void std_span_subspan( bench::state & state )
+{
+    std::span<int const> spn( data() );
+
+    while ( state.keep_running() )
+    {
+        int sum = 0;
+        for ( std::size_t offset = 0; offset + W <= spn.size(); offset += W )
+        {
+            std::span<int const> sub = spn.subspan( offset, W );
+            for ( std::size_t i = 0; i < sub.size(); ++i )
+                sum += sub[i];
+        }
+        bench::do_not_optimize( sum );
+    }
+    state.set_items_processed( static_cast<double>( state.iterations() ) * static_cast<double>( N ) );
+}
+
+void std_span_compare( bench::state & state )
+{
+    std::span<int const> a( data() );
+    std::span<int const> b( other() );
+
+    while ( state.keep_running() )
+    {
+        bool equal = std::equal( a.begin(), a.end(), b.begin(), b.end() );
+        bench::do_not_optimize( equal );
+        bench::clobber_memory();
+    }
+    state.set_items_processed( static_cast<double>( state.iterations() ) * static_cast<double>( N ) );
+}
+
+void std_span_from_container( bench::state & state )
+{
+    std::vector<int> & vec = data();
+
+    while ( state.keep_running() )
+    {
+        std::span<int const> spn( vec );
+        bench::do_not_optimize( spn );
+        bench::clobber_memory();
+    }
+    state.set_items_processed( static_cast<double>( state.iterations() ) );
+}
+
+void std_span_as_bytes( bench::state & state )
+{
+    std::span<int const> spn( data() );
+
+    while ( state.keep_running() )
+    {
+        std::span<const std::byte> bytes = std::as_bytes( spn );
+
+        unsigned sum = 0;
+        for ( std::size_t i = 0; i < bytes.size(); ++i )
+            sum += static_cast<unsigned char>( bytes[i] );
+        bench::do_not_optimize( sum );
+    }
+    state.set_items_processed( static_cast<double>( state.iterations() ) * static_cast<double>( N * sizeof( int ) ) );
+}
+
+#endif // bench_HAVE_STD_SPAN
+
+} // anonymous namespace
+
+BENCHMARK( raw_index );
+BENCHMARK( span_index );
+BENCHMARK( raw_iterate );
+BENCHMARK( span_iterate );
+BENCHMARK( raw_subspan );
+BENCHMARK( span_subspan );
+BENCHMARK( raw_compare );
+#if !span_USES_STD_SPAN && span_FEATURE( COMPARISON )
+BENCHMARK( span_compare );
+#endif
+BENCHMARK( raw_from_container );
+BENCHMARK( span_from_container );
+#if !span_USES_STD_SPAN && ( span_HAVE( BYTE ) || span_HAVE( NONSTD_BYTE ) )
+BENCHMARK( raw_as_bytes );
+BENCHMARK( span_as_bytes );
+#endif
+#if !span_USES_STD_SPAN && span_FEATURE( BIT_SPAN )
+BENCHMARK( raw_bit_count );
+BENCHMARK( span_bit_count );
+#endif
+#if !span_USES_STD_SPAN && span_FEATURE( SPANSTREAM )
+BENCHMARK( raw_format );
+BENCHMARK( span_format );
+#endif
+#if bench_HAVE_STD_SPAN
+BENCHMARK( std_span_index );
+BENCHMARK( std_span_iterate );
+BENCHMARK( std_span_subspan );
+BENCHMARK( std_span_compare );
+BENCHMARK( std_span_from_container );
+BENCHMARK( std_span_as_bytes );
+#endif
+
+int main( int argc, char * argv[] )
+{
+    return bench::run( argc, argv );
+}
+
+// end of file
@@ -133,6 +133,78 @@
 # define span_FEATURE_BYTE_SPAN  0
 #endif
 
+#ifndef  span_FEATURE_STRIDED_SPAN
+# define span_FEATURE_STRIDED_SPAN  0
+#endif
+
+#ifndef  span_FEATURE_UNCHECKED_ACCESS
+# define span_FEATURE_UNCHECKED_ACCESS  0
+#endif
+
+#ifndef  span_FEATURE_HASH
+# define span_FEATURE_HASH  0
+#endif
+
+#ifndef  span_FEATURE_CHUNKS
+# define span_FEATURE_CHUNKS  0
+#endif
+
+#ifndef  span_FEATURE_MDSPAN
+# define span_FEATURE_MDSPAN  0
+#endif
+
+#ifndef  span_FEATURE_ALIGNED_SPAN
+# define span_FEATURE_ALIGNED_SPAN  0
+#endif
+
+#ifndef  span_FEATURE_NOALIAS_SPAN
+# define span_FEATURE_NOALIAS_SPAN  0
+#endif
+
+#ifndef  span_FEATURE_BIT_SPAN
+# define span_FEATURE_BIT_SPAN  0
+#endif
+
+#ifndef  span_FEATURE_RING_VIEW
+# define span_FEATURE_RING_VIEW  0
+#endif
+
+#ifndef  span_FEATURE_SPAN_LIST
+# define span_FEATURE_SPAN_LIST  0
+#endif
+
+#ifndef  span_FEATURE_MAPPED_FILE
+# define span_FEATURE_MAPPED_FILE  0
+#endif
+
+#ifndef  span_FEATURE_BYTE_READER
+# define span_FEATURE_BYTE_READER  0
+#endif
+
+#ifndef  span_FEATURE_BYTE_WRITER
+# define span_FEATURE_BYTE_WRITER  0
+#endif
+
+#ifndef  span_FEATURE_SPANSTREAM
+# define span_FEATURE_SPANSTREAM  0
+#endif
+
+#ifndef  span_FEATURE_MONOTONIC_ARENA
+# define span_FEATURE_MONOTONIC_ARENA  0
+#endif
+
+#ifndef  span_FEATURE_SPAN_VECTOR
+# define span_FEATURE_SPAN_VECTOR  0
+#endif
+
+#ifndef  span_FEATURE_AS_SPAN
+# define span_FEATURE_AS_SPAN  0
+#endif
+
+#ifndef  span_FEATURE_UNALIGNED_SPAN
+# define span_FEATURE_UNALIGNED_SPAN  0
+#endif
+
 // Control presence of exception handling (try and auto discover):
 
 #ifndef span_CONFIG_NO_EXCEPTIONS
@@ -175,6 +247,28 @@
 # error Please define none or one of span_CONFIG_CONTRACT_VIOLATION_THROWS and span_CONFIG_CONTRACT_VIOLATION_TERMINATES to 1, but not both.
 #endif
 
+// Control user-installable contract violation handler and per-site violation counts:
+
+#ifndef  span_CONFIG_CONTRACT_VIOLATION_CALLS_HANDLER
+# ifdef  span_CONFIG_CONTRACT_VIOLATION_HANDLER
+#  define span_CONFIG_CONTRACT_VIOLATION_CALLS_HANDLER  1
+# else
+#  define span_CONFIG_CONTRACT_VIOLATION_CALLS_HANDLER  0
+# endif
+#endif
+
+#ifndef  span_CONFIG_CONTRACT_VIOLATION_HANDLER
+# define span_CONFIG_CONTRACT_VIOLATION_HANDLER  nonstd::span_lite::detail::default_contract_violation_handler
+#endif
+
+#ifndef  span_CONFIG_CONTRACT_VIOLATION_COUNTS
+# define span_CONFIG_CONTRACT_VIOLATION_COUNTS  0
+#endif
+
+#ifndef  span_CONFIG_CONTRACT_VIOLATION_COUNTS_SITES
+# define span_CONFIG_CONTRACT_VIOLATION_COUNTS_SITES  64
+#endif
+
 // C++ language version detection (C++23 is speculative):
 // Note: VC14.0/1900 (VS2015) lacks too much from C++14.
 
@@ -335,6 +429,8 @@ span_DISABLE_MSVC_WARNINGS( 26439 26440 26472 26473 26481 26490 )
 
 #define span_CPP17_000  (span_CPP17_OR_GREATER)
 
+#define span_CPP20_000  (span_CPP20_OR_GREATER)
+
 // Presence of C++11 language features:
 
 #define span_HAVE_ALIAS_TEMPLATE            span_CPP11_140
@@ -359,6 +455,10 @@ span_DISABLE_MSVC_WARNINGS( 26439 26440 26472 26473 26481 26490 )
 #define span_HAVE_DEPRECATED                span_CPP17_000
 #define span_HAVE_NODISCARD                 span_CPP17_000
 
+// Presence of C++20 language features:
+
+#define span_HAVE_CONSTEXPR_20              span_CPP20_000
+
 // MSVC: template parameter deduction guides since Visual Studio 2017 v15.7
 
 #if defined(__cpp_deduction_guides)
@@ -371,16 +471,46 @@ span_DISABLE_MSVC_WARNINGS( 26439 26440 26472 26473 26481 26490 )
 
 #define span_HAVE_ADDRESSOF                 span_CPP17_000
 #define span_HAVE_ARRAY                     span_CPP11_110
+#define span_HAVE_BITOPS                    span_CPP20_000
 #define span_HAVE_BYTE                      span_CPP17_000
 #define span_HAVE_CONDITIONAL               span_CPP11_120
 #define span_HAVE_CONTAINER_DATA_METHOD    (span_CPP11_140 || ( span_COMPILER_MSVC_VER >= 1500 && span_HAS_CPP0X ))
 #define span_HAVE_DATA                      span_CPP17_000
+#define span_HAVE_IS_CONSTANT_EVALUATED     span_CPP20_000
 #define span_HAVE_LONGLONG                  span_CPP11_80
 #define span_HAVE_REMOVE_CONST              span_CPP11_110
 #define span_HAVE_SNPRINTF                  span_CPP11_140
 #define span_HAVE_STRUCT_BINDING            span_CPP11_120
 #define span_HAVE_TYPE_TRAITS               span_CPP11_90
 
+#if span_CPP17_OR_GREATER && defined(__has_include )
+# if __has_include( <memory_resource> )
+#  define span_HAVE_MEMORY_RESOURCE         1
+# else
+#  define span_HAVE_MEMORY_RESOURCE         0
+# endif
+#else
+# define span_HAVE_MEMORY_RESOURCE          0
+#endif
+
+// Presence of compiler extensions:
+
+#define span_HAVE_BUILTIN_EXPECT          ( span_COMPILER_GNUC_VERSION || span_COMPILER_CLANG_VERSION )
+#define span_HAVE_ATTRIBUTE_COLD          ( span_COMPILER_GNUC_VERSION >= 430 || span_COMPILER_CLANG_VERSION )
+#define span_HAVE_ATTRIBUTE_NOINLINE      ( span_COMPILER_GNUC_VERSION || span_COMPILER_CLANG_VERSION )
+#define span_HAVE_DECLSPEC_NOINLINE       ( span_COMPILER_MSVC_VERSION >= 80 )
+#define span_HAVE_BUILTIN_ASSUME_ALIGNED  ( span_COMPILER_GNUC_VERSION >= 470 || span_COMPILER_CLANG_VERSION >= 350 )
+#define span_HAVE_RESTRICT                ( span_COMPILER_GNUC_VERSION || span_COMPILER_CLANG_VERSION || span_COMPILER_MSVC_VERSION >= 80 )
+#define span_HAVE_BUILTIN_POPCOUNT        ( span_COMPILER_GNUC_VERSION >= 340 || span_COMPILER_CLANG_VERSION )
+
+// Presence of POSIX platform features:
+
+#if defined(__unix__) || defined(__unix) || ( defined(__APPLE__) && defined(__MACH__) )
+# define span_HAVE_POSIX  1
+#else
+# define span_HAVE_POSIX  0
+#endif
+
 // Presence of byte-lite:
 
 #ifdef NONSTD_BYTE_LITE_HPP
@@ -409,6 +539,12 @@ span_DISABLE_MSVC_WARNINGS( 26439 26440 26472 26473 26481 26490 )
 # define span_constexpr14 /*span_constexpr*/
 #endif
 
+#if span_HAVE_CONSTEXPR_20
+# define span_constexpr20 constexpr
+#else
+# define span_constexpr20 /*span_constexpr*/
+#endif
+
 #if span_HAVE_EXPLICIT_CONVERSION
 # define span_explicit explicit
 #else
@@ -457,10 +593,53 @@ span_DISABLE_MSVC_WARNINGS( 26439 26440 26472 26473 26481 26490 )
 # define span_noreturn /*[[noreturn]]*/
 #endif
 
+#if span_HAVE_BUILTIN_EXPECT
+# define span_LIKELY( cond )    __builtin_expect( !!( cond ), 1 )
+# define span_UNLIKELY( cond )  __builtin_expect( !!( cond ), 0 )
+#else
+# define span_LIKELY( cond )    ( cond )
+# define span_UNLIKELY( cond )  ( cond )
+#endif
+
+// Out-of-line, rarely executed function, such as a contract violation handler:
+
+#if span_HAVE_ATTRIBUTE_COLD
+# define span_cold_noinline  __attribute__(( noinline, cold ))
+#elif span_HAVE_ATTRIBUTE_NOINLINE
+# define span_cold_noinline  __attribute__(( noinline ))
+#elif span_HAVE_DECLSPEC_NOINLINE
+# define span_cold_noinline  __declspec( noinline )
+#else
+# define span_cold_noinline  /*noinline, cold*/
+#endif
+
+// Code address the current function returns to; in an out-of-line contract
+// violation handler it identifies the check, also after inlining its caller:
+
+#if defined( __GNUC__ ) || defined( __clang__ )
+# define span_RETURN_ADDRESS()  __builtin_return_address( 0 )
+#elif span_COMPILER_MSVC_VERSION
+# define span_RETURN_ADDRESS()  _ReturnAddress()
+#else
+# define span_RETURN_ADDRESS()  span_nullptr
+#endif
+
+// Pointer through which the pointed-to data is accessed exclusively (C99 restrict):
+
+#if ! span_HAVE_RESTRICT
+# define span_RESTRICT  /*restrict*/
+#elif span_COMPILER_MSVC_VERSION
+# define span_RESTRICT  __restrict
+#else
+# define span_RESTRICT  __restrict__
+#endif
+
 // Other features:
 
 #define span_HAVE_CONSTRAINED_SPAN_CONTAINER_CTOR  span_HAVE_DEFAULT_FUNCTION_TEMPLATE_ARG
 #define span_HAVE_ITERATOR_CTOR                    span_HAVE_DEFAULT_FUNCTION_TEMPLATE_ARG
+#define span_HAVE_CONTRACT_VIOLATION_COUNTS      ( span_CONFIG( CONTRACT_VIOLATION_COUNTS ) && span_CPP11_120 )
+#define span_HAVE_MAPPED_FILE                    ( span_FEATURE( MAPPED_FILE ) && span_HAVE_POSIX )
 
 // Additional includes:
 
@@ -492,6 +671,87 @@ span_DISABLE_MSVC_WARNINGS( 26439 26440 26472 26473 26481 26490 )
 # include <cstdio>
 #endif
 
+#if span_FEATURE( COMPARISON ) || span_FEATURE( HASH )
+# include <climits>
+# include <cstring>
+#endif
+
+#if span_FEATURE( HASH ) && span_CPP11_120
+# include <cstdint>
+# include <functional>
+#endif
+
+#if span_FEATURE( STRIDED_SPAN ) || span_FEATURE( RING_VIEW ) || span_FEATURE( UNALIGNED_SPAN )
+# include <iterator>
+#endif
+
+#if span_FEATURE( STRIDED_SPAN )
+# include <limits>
+#endif
+
+#if ( span_FEATURE( ALIGNED_SPAN ) || span_FEATURE( MAPPED_FILE ) || span_FEATURE( BYTE_READER ) || span_FEATURE( BYTE_WRITER ) || span_FEATURE( MONOTONIC_ARENA ) || span_FEATURE( SPAN_VECTOR ) || span_FEATURE( AS_SPAN ) || span_FEATURE( UNALIGNED_SPAN ) ) && span_CPP11_120
+# include <cstdint>
+#endif
+
+#if span_FEATURE( NOALIAS_SPAN )
+# include <functional>
+#endif
+
+#if span_FEATURE( SPAN_LIST )
+# include <vector>
+# if span_HAVE( POSIX )
+#  include <sys/uio.h>
+# endif
+#endif
+
+#if span_HAVE( MAPPED_FILE )
+# include <cerrno>
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+#if span_FEATURE( BYTE_READER ) || span_FEATURE( BYTE_WRITER )
+# include <climits>
+#endif
+
+#if span_FEATURE( BYTE_WRITER ) || span_FEATURE( UNALIGNED_SPAN )
+# include <cstring>
+#endif
+
+#if span_FEATURE( SPAN_VECTOR )
+# include <new>
+# include <utility>
+#endif
+
+#if span_FEATURE( MONOTONIC_ARENA ) && span_HAVE( MEMORY_RESOURCE )
+# include <memory_resource>
+# include <new>
+#endif
+
+#if span_FEATURE( SPANSTREAM )
+# include <climits>
+# include <istream>
+# include <ostream>
+# include <streambuf>
+#endif
+
+#if span_FEATURE( BIT_SPAN )
+# include <climits>
+# if span_HAVE( BITOPS )
+#  include <bit>
+# endif
+#endif
+
+#if span_HAVE( CONTRACT_VIOLATION_COUNTS )
+# include <atomic>
+# include <cstdint>
+# if span_COMPILER_MSVC_VERSION
+#  include <intrin.h>
+# endif
+#endif
+
 #if ! span_CONFIG( NO_EXCEPTIONS )
 # include <stdexcept>
 #elif ! span_CONFIG( CONTRACT_VIOLATION_THROWS_V )
@@ -519,8 +779,12 @@ span_DISABLE_MSVC_WARNINGS( 26439 26440 26472 26473 26481 26490 )
 # define span_ENSURES( cond )  span_CONTRACT_CHECK( "Postcondition", cond )
 #endif
 
+// Compile-time arguments of a span of static extent are checked via static_assert:
+
+#define span_STATICALLY_CHECKED( extent )  ( span_HAVE( STATIC_ASSERT ) && (extent) != dynamic_extent )
+
 #define span_CONTRACT_CHECK( type, cond ) \
-    cond ? static_cast< void >( 0 ) \
+    span_LIKELY( cond ) ? static_cast< void >( 0 ) \
          : nonstd::span_lite::detail::report_contract_violation( span_LOCATION( __FILE__, __LINE__ ) ": " type " violation." )
 
 #ifdef __GNUG__
@@ -720,6 +984,15 @@ span_constexpr bool is_positive( T x )
     return std11::is_signed<T>::value ? x >= 0 : true;
 }
 
+// extent of subspan<Offset, Count>():
+
+template< extent_t Extent, size_t Offset, extent_t Count >
+struct subspan_extent
+{
+    static const extent_t value = Count != dynamic_extent
+        ? Count : ( Extent != dynamic_extent ? Extent - static_cast<extent_t>( Offset ) : dynamic_extent );
+};
+
 #if span_HAVE( TYPE_TRAITS )
 
 template< class Q >
@@ -812,6 +1085,8 @@ struct is_compatible_container : std::true_type{};
 
 #endif // span_HAVE( TYPE_TRAITS )
 
+// Failure paths are out-of-line and cold, to keep the checks in accessors small:
+
 #if ! span_CONFIG( NO_EXCEPTIONS )
 #if   span_FEATURE( MEMBER_AT ) > 1
 
@@ -824,7 +1099,7 @@ struct is_compatible_container : std::true_type{};
 # pragma GCC   diagnostic ignored "-Wlong-long"
 #endif
 
-span_noreturn inline void throw_out_of_range( size_t idx, size_t size )
+span_noreturn span_cold_noinline inline void throw_out_of_range( size_t idx, size_t size )
 {
     const char fmt[] = "span::at(): index '%lli' is out of range [0..%lli)";
     char buffer[ 2 * 20 + sizeof fmt ];
@@ -835,7 +1110,7 @@ span_noreturn inline void throw_out_of_range( size_t idx, size_t size )
 
 #else // MEMBER_AT
 
-span_noreturn inline void throw_out_of_range( size_t /*idx*/, size_t /*size*/ )
+span_noreturn span_cold_noinline inline void throw_out_of_range( size_t /*idx*/, size_t /*size*/ )
 {
     throw std::out_of_range( "span::at(): index outside span" );
 }
@@ -851,22 +1126,241 @@ struct contract_violation : std::logic_error
     {}
 };
 
-inline void report_contract_violation( char const * msg )
+span_noreturn span_cold_noinline inline void default_contract_violation_handler( char const * msg )
 {
     throw contract_violation( msg );
 }
 
 #else // span_CONFIG( CONTRACT_VIOLATION_THROWS_V )
 
-span_noreturn inline void report_contract_violation( char const * /*msg*/ ) span_noexcept
+span_noreturn span_cold_noinline inline void default_contract_violation_handler( char const * /*msg*/ ) span_noexcept
 {
     std::terminate();
 }
 
 #endif // span_CONFIG( CONTRACT_VIOLATION_THROWS_V )
 
+#if span_HAVE( CONTRACT_VIOLATION_COUNTS )
+
+// Violation counts per call site in a fixed-size, lock-free open-addressing table.
+// A call site is identified by the code address of the failing check: as checked
+// accessors are inlined into their callers in an optimized build, each call of
+// e.g. operator[] has its own address. Without inlining, or if the compiler cannot
+// provide the address, the "file:line: type violation." message in span.hpp is
+// used, and the calls of an accessor share an entry. Once claimed, an entry keeps
+// its key, so that probing never needs to skip removed entries.
+
+struct contract_violation_entry
+{
+    std::atomic< void const * > key;
+    std::atomic< char const * > site;
+    std::atomic< unsigned long > count;
+};
+
+inline contract_violation_entry * contract_violation_table() span_noexcept
+{
+    static contract_violation_entry table[ span_CONFIG_CONTRACT_VIOLATION_COUNTS_SITES ];
+    return table;
+}
+
+inline size_t contract_violation_key_hash( void const * key ) span_noexcept
+{
+    return static_cast<size_t>( ( reinterpret_cast<std::uintptr_t>( key ) >> 2 ) * 0x9E3779B1u );
+}
+
+// The site message is stored after claiming the key; readers skip an entry
+// until its message is visible:
+
+inline void count_contract_violation( void const * address, char const * site ) span_noexcept
+{
+    contract_violation_entry * const table = contract_violation_table();
+    size_t const sites = span_CONFIG_CONTRACT_VIOLATION_COUNTS_SITES;
+    void const * const key = address != span_nullptr ? address : static_cast<void const *>( site );
+
+    for ( size_t i = 0, k = contract_violation_key_hash( key ) % sites; i < sites; ++i, k = ( k + 1 ) % sites )
+    {
+        void const * entry = table[k].key.load( std::memory_order_acquire );
+
+        if ( entry == span_nullptr && table[k].key.compare_exchange_strong( entry, key, std::memory_order_acq_rel ) )
+        {
+            table[k].site.store( site, std::memory_order_release );
+            entry = key;
+        }
+
+        if ( entry == key )
+        {
+            table[k].count.fetch_add( 1, std::memory_order_relaxed );
+            return;
+        }
+    }
+    // table is full: violation is not counted.
+}
+
+#endif // span_HAVE( CONTRACT_VIOLATION_COUNTS )
+
+#if span_CONFIG( CONTRACT_VIOLATION_CALLS_HANDLER )
+
+typedef void ( * contract_violation_handler_t )( char const * msg );
+
+inline contract_violation_handler_t & installed_contract_violation_handler() span_noexcept
+{
+    static contract_violation_handler_t handler = &span_CONFIG_CONTRACT_VIOLATION_HANDLER;
+    return handler;
+}
+
+// Execution continues after the violation if the installed handler returns:
+
+span_cold_noinline inline void report_contract_violation( char const * msg ) span_noexcept
+{
+#if span_HAVE( CONTRACT_VIOLATION_COUNTS )
+    count_contract_violation( span_RETURN_ADDRESS(), msg );
+#endif
+    installed_contract_violation_handler()( msg );
+}
+
+#else // span_CONFIG( CONTRACT_VIOLATION_CALLS_HANDLER )
+
+span_noreturn span_cold_noinline inline void report_contract_violation( char const * msg ) span_noexcept
+{
+#if span_HAVE( CONTRACT_VIOLATION_COUNTS )
+    count_contract_violation( span_RETURN_ADDRESS(), msg );
+#endif
+    default_contract_violation_handler( msg );
+}
+
+#endif // span_CONFIG( CONTRACT_VIOLATION_CALLS_HANDLER )
+
+// Tag to construct a span without checking its preconditions:
+
+struct unchecked_t { span_constexpr unchecked_t() span_noexcept {} };
+const  span_constexpr   unchecked_t unchecked;
+
+// Storage for span: the size is only stored for dynamic extent,
+// so that a span of static extent has the size of a pointer:
+
+template< class T, extent_t Extent >
+struct span_storage
+{
+    span_constexpr span_storage() span_noexcept
+        : data_( span_nullptr )
+    {}
+
+    span_constexpr span_storage( T * ptr, size_t /*count*/ ) span_noexcept
+        : data_( ptr )
+    {}
+
+    span_constexpr size_t size() const span_noexcept
+    {
+        return static_cast<size_t>( Extent );
+    }
+
+    T * data_;
+};
+
+template< class T >
+struct span_storage< T, dynamic_extent >
+{
+    span_constexpr span_storage() span_noexcept
+        : data_( span_nullptr )
+        , size_( 0 )
+    {}
+
+    span_constexpr span_storage( T * ptr, size_t count ) span_noexcept
+        : data_( ptr )
+        , size_( count )
+    {}
+
+    span_constexpr size_t size() const span_noexcept
+    {
+        return size_;
+    }
+
+    T * data_;
+    size_t size_;
+};
+
 }  // namespace detail
 
+#if span_CONFIG( CONTRACT_VIOLATION_CALLS_HANDLER )
+
+// Contract violation handler; install it before other threads use spans:
+
+typedef detail::contract_violation_handler_t contract_violation_handler;
+
+inline contract_violation_handler get_contract_violation_handler() span_noexcept
+{
+    return detail::installed_contract_violation_handler();
+}
+
+// Install handler, or the compile-time default handler for a null pointer;
+// return the previously installed handler:
+
+inline contract_violation_handler set_contract_violation_handler( contract_violation_handler handler ) span_noexcept
+{
+    contract_violation_handler const previous = detail::installed_contract_violation_handler();
+
+    detail::installed_contract_violation_handler() = handler != span_nullptr ? handler : &span_CONFIG_CONTRACT_VIOLATION_HANDLER;
+
+    return previous;
+}
+
+#endif // span_CONFIG( CONTRACT_VIOLATION_CALLS_HANDLER )
+
+#if span_HAVE( CONTRACT_VIOLATION_COUNTS )
+
+// Number of contract violations at a call site; site is the check's
+// "file:line: type violation." message, address the code address of the
+// failing check, for use with e.g. addr2line (null if not available):
+
+struct contract_violation_count
+{
+    char const *  site;
+    unsigned long count;
+    void const *  address;
+};
+
+// Copy up to n call sites with their violation count to counts,
+// return the number of call sites with a recorded violation:
+
+inline size_t contract_violation_counts( contract_violation_count * counts, size_t n ) span_noexcept
+{
+    detail::contract_violation_entry const * const table = detail::contract_violation_table();
+    size_t found = 0;
+
+    for ( size_t k = 0; k < span_CONFIG_CONTRACT_VIOLATION_COUNTS_SITES; ++k )
+    {
+        char const * const site = table[k].site.load( std::memory_order_acquire );
+
+        if ( site == span_nullptr )
+            continue;
+
+        if ( found < n )
+        {
+            void const * const key = table[k].key.load( std::memory_order_relaxed );
+
+            counts[ found ].site    = site;
+            counts[ found ].count   = table[k].count.load( std::memory_order_relaxed );
+            counts[ found ].address = key != static_cast<void const *>( site ) ? key : span_nullptr;
+        }
+        ++found;
+    }
+    return found;
+}
+
+// Reset the counts; recorded call sites keep their table entry:
+
+inline void reset_contract_violation_counts() span_noexcept
+{
+    detail::contract_violation_entry * const table = detail::contract_violation_table();
+
+    for ( size_t k = 0; k < span_CONFIG_CONTRACT_VIOLATION_COUNTS_SITES; ++k )
+    {
+        table[k].count.store( 0, std::memory_order_relaxed );
+    }
+}
+
+#endif // span_HAVE( CONTRACT_VIOLATION_COUNTS )
+
 // Prevent signed-unsigned mismatch:
 
 #define span_sizeof(T)  static_cast<extent_t>( sizeof(T) )
@@ -915,8 +1409,7 @@ public:
         ( Extent == dynamic_extent )
     )
     span_constexpr span() span_noexcept
-        : data_( span_nullptr )
-        , size_( 0 )
+        : storage_( span_nullptr, 0 )
     {
         // span_EXPECTS( data() == span_nullptr );
         // span_EXPECTS( size() == 0 );
@@ -926,10 +1419,10 @@ public:
     // Didn't yet succeed in combining the next two constructors:
 
     span_constexpr_exp span( std::nullptr_t, size_type count )
-        : data_( span_nullptr )
-        , size_( count )
+        : storage_( span_nullptr, count )
     {
-        span_EXPECTS( data_ == span_nullptr && count == 0 );
+        span_EXPECTS( data() == span_nullptr && count == 0 );
+        span_EXPECTS( Extent == dynamic_extent || count == to_size( Extent ) );
     }
 
     template< typename It
@@ -938,23 +1431,23 @@ public:
         ))
     >
     span_constexpr_exp span( It first, size_type count )
-        : data_( to_address( first ) )
-        , size_( count )
+        : storage_( to_address( first ), count )
     {
         span_EXPECTS(
-            ( data_ == span_nullptr && count == 0 ) ||
-            ( data_ != span_nullptr && detail::is_positive( count ) )
+            ( data() == span_nullptr && count == 0 ) ||
+            ( data() != span_nullptr && detail::is_positive( count ) )
         );
+        span_EXPECTS( Extent == dynamic_extent || count == to_size( Extent ) );
     }
 #else
     span_constexpr_exp span( pointer ptr, size_type count )
-        : data_( ptr )
-        , size_( count )
+        : storage_( ptr, count )
     {
         span_EXPECTS(
             ( ptr == span_nullptr && count == 0 ) ||
             ( ptr != span_nullptr && detail::is_positive( count ) )
         );
+        span_EXPECTS( Extent == dynamic_extent || count == to_size( Extent ) );
     }
 #endif
 
@@ -966,21 +1459,21 @@ public:
         ))
      >
     span_constexpr_exp span( It first, End last )
-        : data_( to_address( first ) )
-        , size_( to_size( last - first ) )
+        : storage_( to_address( first ), to_size( last - first ) )
     {
         span_EXPECTS(
              last - first >= 0
         );
+        span_EXPECTS( Extent == dynamic_extent || to_size( last - first ) == to_size( Extent ) );
     }
 #else
     span_constexpr_exp span( pointer first, pointer last )
-        : data_( first )
-        , size_( to_size( last - first ) )
+        : storage_( first, to_size( last - first ) )
     {
         span_EXPECTS(
             last - first >= 0
         );
+        span_EXPECTS( Extent == dynamic_extent || to_size( last - first ) == to_size( Extent ) );
     }
 #endif
 
@@ -991,8 +1484,7 @@ public:
         ))
     >
     span_constexpr span( element_type ( &arr )[ N ] ) span_noexcept
-        : data_( span_ADDRESSOF( arr[0] ) )
-        , size_( N  )
+        : storage_( span_ADDRESSOF( arr[0] ), N )
     {}
 
 #if span_HAVE( ARRAY )
@@ -1008,8 +1500,7 @@ public:
 # else
         span_constexpr span( std::array< value_type, N > & arr ) span_noexcept
 # endif
-        : data_( arr.data() )
-        , size_( to_size( arr.size() ) )
+        : storage_( arr.data(), to_size( arr.size() ) )
     {}
 
     template< std::size_t N
@@ -1021,8 +1512,7 @@ public:
 # endif
     >
     span_constexpr span( std::array< value_type, N> const & arr ) span_noexcept
-        : data_( arr.data() )
-        , size_( to_size( arr.size() ) )
+        : storage_( arr.data(), to_size( arr.size() ) )
     {}
 
 #endif // span_HAVE( ARRAY )
@@ -1034,8 +1524,7 @@ public:
         ))
     >
     span_constexpr span( Container & cont )
-        : data_( std17::data( cont ) )
-        , size_( to_size( std17::size( cont ) ) )
+        : storage_( std17::data( cont ), to_size( std17::size( cont ) ) )
     {}
 
     template< class Container
@@ -1045,8 +1534,7 @@ public:
         ))
     >
     span_constexpr span( Container const & cont )
-        : data_( std17::data( cont ) )
-        , size_( to_size( std17::size( cont ) ) )
+        : storage_( std17::data( cont ), to_size( std17::size( cont ) ) )
     {}
 
 #endif // span_HAVE( CONSTRAINED_SPAN_CONTAINER_CTOR )
@@ -1055,17 +1543,21 @@ public:
 
     template< class Container >
     span_constexpr span( with_container_t, Container & cont )
-        : data_( cont.size() == 0 ? span_nullptr : span_ADDRESSOF( cont[0] ) )
-        , size_( to_size( cont.size() ) )
+        : storage_( cont.size() == 0 ? span_nullptr : span_ADDRESSOF( cont[0] ), to_size( cont.size() ) )
     {}
 
     template< class Container >
     span_constexpr span( with_container_t, Container const & cont )
-        : data_( cont.size() == 0 ? span_nullptr : const_cast<pointer>( span_ADDRESSOF( cont[0] ) ) )
-        , size_( to_size( cont.size() ) )
+        : storage_( cont.size() == 0 ? span_nullptr : const_cast<pointer>( span_ADDRESSOF( cont[0] ) ), to_size( cont.size() ) )
     {}
 #endif
 
+    // for views that validate their bounds once up front [span-lite extension]:
+
+    span_constexpr span( detail::unchecked_t, pointer ptr, size_type count ) span_noexcept
+        : storage_( ptr, count )
+    {}
+
 #if span_FEATURE( WITH_INITIALIZER_LIST_P2447 ) && span_HAVE( INITIALIZER_LIST )
 
     // constexpr explicit(extent != dynamic_extent) span(std::initializer_list<value_type> il) noexcept;
@@ -1080,14 +1572,16 @@ public:
 #if span_COMPILER_GNUC_VERSION >= 900   // prevent GCC's "-Winit-list-lifetime"
     span_constexpr14 explicit span( std::initializer_list<value_type> il ) span_noexcept
     {
-        data_ = il.begin();
-        size_ = il.size();
+        span_EXPECTS( il.size() == to_size( Extent ) );
+
+        storage_ = storage_type( il.begin(), il.size() );
     }
 #else
-    span_constexpr explicit span( std::initializer_list<value_type> il ) span_noexcept
-        : data_( il.begin() )
-        , size_( il.size()  )
-    {}
+    span_constexpr_exp explicit span( std::initializer_list<value_type> il ) span_noexcept
+        : storage_( il.begin(), il.size() )
+    {
+        span_EXPECTS( il.size() == to_size( Extent ) );
+    }
 #endif
 
 #endif // MSVC 120 (VS2013)
@@ -1100,13 +1594,11 @@ public:
 #if span_COMPILER_GNUC_VERSION >= 900   // prevent GCC's "-Winit-list-lifetime"
     span_constexpr14 /*explicit*/ span( std::initializer_list<value_type> il ) span_noexcept
     {
-        data_ = il.begin();
-        size_ = il.size();
+        storage_ = storage_type( il.begin(), il.size() );
     }
 #else
     span_constexpr /*explicit*/ span( std::initializer_list<value_type> il ) span_noexcept
-        : data_( il.begin() )
-        , size_( il.size()  )
+        : storage_( il.begin(), il.size() )
     {}
 #endif
 
@@ -1119,21 +1611,9 @@ public:
 
     span_constexpr14 span & operator=( span const & other ) span_noexcept = default;
 #else
-    span_constexpr span( span const & other ) span_noexcept
-        : data_( other.data_ )
-        , size_( other.size_ )
-    {}
-
-    ~span() span_noexcept
-    {}
-
-    span_constexpr14 span & operator=( span const & other ) span_noexcept
-    {
-        data_ = other.data_;
-        size_ = other.size_;
-
-        return *this;
-    }
+    // Rely on the implicitly declared copy constructor, copy assignment and destructor:
+    // user-provided ones would make span non-trivially copyable, so that it
+    // could no longer be passed in registers.
 #endif
 
     template< class OtherElementType, extent_type OtherExtent
@@ -1143,30 +1623,39 @@ public:
         ))
     >
     span_constexpr_exp span( span<OtherElementType, OtherExtent> const & other ) span_noexcept
-        : data_( other.data() )
-        , size_( other.size() )
+        : storage_( other.data(), other.size() )
     {
-        span_EXPECTS( OtherExtent == dynamic_extent || other.size() == to_size(OtherExtent) );
+        span_EXPECTS( Extent == dynamic_extent || other.size() == to_size(Extent) );
     }
 
     // 26.7.3.3 Subviews [span.sub]
 
+    // For a span of static extent, the compile-time arguments are checked
+    // at compile time (C++11) and no runtime check remains. Once the arguments
+    // are checked, the result is valid and is built without further checks.
+
     template< extent_type Count >
     span_constexpr_exp span< element_type, Count >
     first() const
     {
-        span_EXPECTS( detail::is_positive( Count ) && Count <= size() );
+#if span_HAVE( STATIC_ASSERT )
+        static_assert( Extent == dynamic_extent || ( detail::is_positive( Count ) && Count <= Extent ), "first<Count>(): Count out of range" );
+#endif
+        span_EXPECTS( span_STATICALLY_CHECKED( Extent ) || ( detail::is_positive( Count ) && Count <= size() ) );
 
-        return span< element_type, Count >( data(), Count );
+        return span< element_type, Count >( detail::unchecked, data(), Count );
     }
 
     template< extent_type Count >
     span_constexpr_exp span< element_type, Count >
     last() const
     {
-        span_EXPECTS( detail::is_positive( Count ) && Count <= size() );
+#if span_HAVE( STATIC_ASSERT )
+        static_assert( Extent == dynamic_extent || ( detail::is_positive( Count ) && Count <= Extent ), "last<Count>(): Count out of range" );
+#endif
+        span_EXPECTS( span_STATICALLY_CHECKED( Extent ) || ( detail::is_positive( Count ) && Count <= size() ) );
 
-        return span< element_type, Count >( data() + (size() - Count), Count );
+        return span< element_type, Count >( detail::unchecked, data() + (size() - Count), Count );
     }
 
 #if span_HAVE( DEFAULT_FUNCTION_TEMPLATE_ARG )
@@ -1174,15 +1663,20 @@ public:
 #else
     template< size_type Offset, extent_type Count /*= dynamic_extent*/ >
 #endif
-    span_constexpr_exp span< element_type, Count >
+    span_constexpr_exp span< element_type, detail::subspan_extent< Extent, Offset, Count >::value >
     subspan() const
     {
-        span_EXPECTS(
+#if span_HAVE( STATIC_ASSERT )
+        static_assert( Extent == dynamic_extent || Offset <= static_cast<size_type>( Extent ), "subspan<Offset,Count>(): Offset out of range" );
+        static_assert( Extent == dynamic_extent || Count == dynamic_extent
+            || ( detail::is_positive( Count ) && static_cast<size_type>( Count ) <= static_cast<size_type>( Extent ) - Offset ), "subspan<Offset,Count>(): Count out of range" );
+#endif
+        span_EXPECTS( span_STATICALLY_CHECKED( Extent ) || (
             ( detail::is_positive( Offset ) && Offset <= size() ) &&
-            ( Count == dynamic_extent || (detail::is_positive( Count ) && Count + Offset <= size()) )
+            ( Count == dynamic_extent || (detail::is_positive( Count ) && Count + Offset <= size()) ) )
         );
 
-        return span< element_type, Count >(
+        return span< element_type, detail::subspan_extent< Extent, Offset, Count >::value >( detail::unchecked,
             data() + Offset, Count != dynamic_extent ? Count : (Extent != dynamic_extent ? Extent - Offset : size() - Offset) );
     }
 
@@ -1214,16 +1708,41 @@ public:
             data() + offset, count == static_cast<size_type>(dynamic_extent) ? size() - offset : count );
     }
 
+#if span_FEATURE( UNCHECKED_ACCESS )
+
+    // sub views without precondition checks, for hot paths that validated their bounds already:
+
+    span_constexpr span< element_type, dynamic_extent >
+    unchecked_first( size_type count ) const span_noexcept
+    {
+        return span< element_type, dynamic_extent >( detail::unchecked, data(), count );
+    }
+
+    span_constexpr span< element_type, dynamic_extent >
+    unchecked_last( size_type count ) const span_noexcept
+    {
+        return span< element_type, dynamic_extent >( detail::unchecked, data() + ( size() - count ), count );
+    }
+
+    span_constexpr span< element_type, dynamic_extent >
+    unchecked_subspan( size_type offset, size_type count = static_cast<size_type>(dynamic_extent) ) const span_noexcept
+    {
+        return span< element_type, dynamic_extent >(
+            detail::unchecked, data() + offset, count == static_cast<size_type>(dynamic_extent) ? size() - offset : count );
+    }
+
+#endif // span_FEATURE( UNCHECKED_ACCESS )
+
     // 26.7.3.4 Observers [span.obs]
 
     span_constexpr size_type size() const span_noexcept
     {
-        return size_;
+        return storage_.size();
     }
 
     span_constexpr std::ptrdiff_t ssize() const span_noexcept
     {
-        return static_cast<std::ptrdiff_t>( size_ );
+        return static_cast<std::ptrdiff_t>( size() );
     }
 
     span_constexpr size_type size_bytes() const span_noexcept
@@ -1262,7 +1781,7 @@ public:
 #if span_CONFIG( NO_EXCEPTIONS )
         return this->operator[]( idx );
 #else
-        if ( !detail::is_positive( idx ) || size() <= idx )
+        if ( span_UNLIKELY( !detail::is_positive( idx ) || size() <= idx ) )
         {
             detail::throw_out_of_range( idx, size() );
         }
@@ -1271,9 +1790,16 @@ public:
     }
 #endif
 
+#if span_FEATURE( UNCHECKED_ACCESS )
+    span_constexpr reference unchecked_at( size_type idx ) const span_noexcept
+    {
+        return *( data() + idx );
+    }
+#endif
+
     span_constexpr pointer data() const span_noexcept
     {
-        return data_;
+        return storage_.data_;
     }
 
 #if span_FEATURE( MEMBER_BACK_FRONT )
@@ -1301,8 +1827,7 @@ public:
     span_constexpr14 void swap( span & other ) span_noexcept
     {
         using std::swap;
-        swap( data_, other.data_ );
-        swap( size_, other.size_ );
+        swap( storage_, other.storage_ );
     }
 #endif
 
@@ -1390,8 +1915,9 @@ private:
 #endif // span_HAVE( ITERATOR_CTOR )
 
 private:
-    pointer   data_;
-    size_type size_;
+    typedef detail::span_storage< element_type, Extent > storage_type;
+
+    storage_type storage_;
 };
 
 // class template argument deduction guides:
@@ -1426,6 +1952,110 @@ span( It, EndOrSize ) -> span< typename std11::remove_reference< typename std20:
 
 // 26.7.3.7 Comparison operators [span.comparison]
 
+#if span_FEATURE( COMPARISON ) || span_FEATURE( HASH )
+
+namespace detail {
+
+// Element types for which equality of values is equality of object representation:
+
+template< class T > struct is_bitwise_comparable : std11::false_type {};
+
+template<> struct is_bitwise_comparable< bool               > : std11::true_type {};
+template<> struct is_bitwise_comparable< char               > : std11::true_type {};
+template<> struct is_bitwise_comparable< signed char        > : std11::true_type {};
+template<> struct is_bitwise_comparable< unsigned char      > : std11::true_type {};
+template<> struct is_bitwise_comparable< wchar_t            > : std11::true_type {};
+template<> struct is_bitwise_comparable< short              > : std11::true_type {};
+template<> struct is_bitwise_comparable< unsigned short     > : std11::true_type {};
+template<> struct is_bitwise_comparable< int                > : std11::true_type {};
+template<> struct is_bitwise_comparable< unsigned int       > : std11::true_type {};
+template<> struct is_bitwise_comparable< long               > : std11::true_type {};
+template<> struct is_bitwise_comparable< unsigned long      > : std11::true_type {};
+#if span_HAVE( LONGLONG )
+template<> struct is_bitwise_comparable< long long          > : std11::true_type {};
+template<> struct is_bitwise_comparable< unsigned long long > : std11::true_type {};
+#endif
+#if span_CPP11_OR_GREATER
+template<> struct is_bitwise_comparable< char16_t           > : std11::true_type {};
+template<> struct is_bitwise_comparable< char32_t           > : std11::true_type {};
+#endif
+#if defined( __cpp_char8_t )
+template<> struct is_bitwise_comparable< char8_t            > : std11::true_type {};
+#endif
+#if span_HAVE( BYTE ) || span_HAVE( NONSTD_BYTE )
+template<> struct is_bitwise_comparable< std17::byte        > : std11::true_type {};
+#endif
+
+// Element types for which the order of values is the order of their bytes as by memcmp():
+
+template< class T > struct is_bytewise_ordered : std11::false_type {};
+
+template<> struct is_bytewise_ordered< bool                 > : std11::true_type {};
+template<> struct is_bytewise_ordered< char                 > : std17::bool_constant< CHAR_MIN == 0 > {};
+template<> struct is_bytewise_ordered< unsigned char        > : std11::true_type {};
+#if defined( __cpp_char8_t )
+template<> struct is_bytewise_ordered< char8_t              > : std11::true_type {};
+#endif
+#if span_HAVE( BYTE ) || span_HAVE( NONSTD_BYTE )
+template<> struct is_bytewise_ordered< std17::byte          > : std11::true_type {};
+#endif
+
+template< class T1, class T2 >
+struct is_memcmp_equality_comparable : std17::bool_constant<
+    std11::is_same< typename std11::remove_cv< T1 >::type, typename std11::remove_cv< T2 >::type >::value
+    && is_bitwise_comparable< typename std11::remove_cv< T1 >::type >::value > {};
+
+template< class T1, class T2 >
+struct is_memcmp_less_comparable : std17::bool_constant<
+    std11::is_same< typename std11::remove_cv< T1 >::type, typename std11::remove_cv< T2 >::type >::value
+    && is_bytewise_ordered< typename std11::remove_cv< T1 >::type >::value > {};
+
+// Compare elements via memcmp() where possible, which the C library typically implements
+// with vector instructions; otherwise compare element by element:
+
+template< class T1, class T2 >
+inline span_constexpr20 bool equal_elements( T1 const * l, T2 const * r, size_t n, std11::true_type )
+{
+#if span_HAVE( IS_CONSTANT_EVALUATED )
+    if ( std::is_constant_evaluated() )
+    {
+        return std::equal( l, l + n, r );
+    }
+#endif
+    return n == 0 || std::memcmp( l, r, n * sizeof( T1 ) ) == 0;
+}
+
+template< class T1, class T2 >
+inline span_constexpr20 bool equal_elements( T1 const * l, T2 const * r, size_t n, std11::false_type )
+{
+    return std::equal( l, l + n, r );
+}
+
+template< class T1, class T2 >
+inline span_constexpr20 bool less_elements( T1 const * l, size_t ln, T2 const * r, size_t rn, std11::true_type )
+{
+#if span_HAVE( IS_CONSTANT_EVALUATED )
+    if ( std::is_constant_evaluated() )
+    {
+        return std::lexicographical_compare( l, l + ln, r, r + rn );
+    }
+#endif
+    size_t const n = ln < rn ? ln : rn;
+    int    const c = n == 0 ? 0 : std::memcmp( l, r, n * sizeof( T1 ) );
+
+    return c < 0 || ( c == 0 && ln < rn );
+}
+
+template< class T1, class T2 >
+inline span_constexpr20 bool less_elements( T1 const * l, size_t ln, T2 const * r, size_t rn, std11::false_type )
+{
+    return std::lexicographical_compare( l, l + ln, r, r + rn );
+}
+
+}  // namespace detail
+
+#endif // span_FEATURE( COMPARISON ) || span_FEATURE( HASH )
+
 #if span_FEATURE( COMPARISON )
 #if span_FEATURE( SAME )
 
@@ -1446,13 +2076,15 @@ inline span_constexpr bool operator==( span<T1,E1> const & l, span<T2,E2> const
 #if span_FEATURE( SAME )
         same( l, r ) ||
 #endif
-        ( l.size() == r.size() && std::equal( l.begin(), l.end(), r.begin() ) );
+        ( l.size() == r.size() && detail::equal_elements( l.data(), r.data(), l.size(),
+            std17::bool_constant< detail::is_memcmp_equality_comparable<T1, T2>::value >() ) );
 }
 
 template< class T1, extent_t E1, class T2, extent_t E2  >
 inline span_constexpr bool operator<( span<T1,E1> const & l, span<T2,E2> const & r )
 {
-    return std::lexicographical_compare( l.begin(), l.end(), r.begin(), r.end() );
+    return detail::less_elements( l.data(), l.size(), r.data(), r.size(),
+        std17::bool_constant< detail::is_memcmp_less_comparable<T1, T2>::value >() );
 }
 
 template< class T1, extent_t E1, class T2, extent_t E2  >
@@ -1481,6 +2113,250 @@ inline span_constexpr bool operator>=( span<T1,E1> const & l, span<T2,E2> const
 
 #endif // span_FEATURE( COMPARISON )
 
+// checked_policy, unchecked_policy [span-lite extension]: element access and sub views
+// with a per-call choice to check preconditions, for example:
+//
+//     typedef nonstd::unchecked_policy hot_path;   // per translation unit or per loop
+//     sum += nonstd::at<hot_path>( spn, i );
+//
+// The checked policy honours span_CONFIG_CONTRACT_LEVEL_*. As each policy yields a
+// distinct instantiation, translation units may choose different policies safely.
+
+#if span_FEATURE( UNCHECKED_ACCESS ) || span_FEATURE( BYTE_READER ) || span_FEATURE( BYTE_WRITER )
+
+struct checked_policy
+{
+    static const bool checked = true;
+};
+
+struct unchecked_policy
+{
+    static const bool checked = false;
+};
+
+#endif // span_FEATURE( UNCHECKED_ACCESS ) || span_FEATURE( BYTE_READER ) || span_FEATURE( BYTE_WRITER )
+
+#if span_FEATURE( UNCHECKED_ACCESS )
+
+template< class Policy, class T, extent_t Extent >
+inline span_constexpr_exp T & at( span<T, Extent> spn, size_t idx )
+{
+    span_EXPECTS( !Policy::checked || idx < spn.size() );
+
+    return spn.unchecked_at( idx );
+}
+
+template< class Policy, class T, extent_t Extent >
+inline span_constexpr_exp span<T> first( span<T, Extent> spn, size_t count )
+{
+    span_EXPECTS( !Policy::checked || count <= spn.size() );
+
+    return spn.unchecked_first( count );
+}
+
+template< class Policy, class T, extent_t Extent >
+inline span_constexpr_exp span<T> last( span<T, Extent> spn, size_t count )
+{
+    span_EXPECTS( !Policy::checked || count <= spn.size() );
+
+    return spn.unchecked_last( count );
+}
+
+template< class Policy, class T, extent_t Extent >
+inline span_constexpr_exp span<T> subspan( span<T, Extent> spn, size_t offset, size_t count = static_cast<size_t>( dynamic_extent ) )
+{
+    span_EXPECTS( !Policy::checked || (
+        offset <= spn.size() &&
+        ( count == static_cast<size_t>( dynamic_extent ) || count <= spn.size() - offset ) )
+    );
+
+    return spn.unchecked_subspan( offset, count );
+}
+
+#endif // span_FEATURE( UNCHECKED_ACCESS )
+
+// span_hash, span_equal [span-lite extension]: hash and compare the content of spans,
+// span_identity_hash, span_identity_equal: hash and compare the identity of spans as same():
+
+#if span_FEATURE( HASH ) && span_CPP11_120
+
+namespace detail {
+
+// MurmurHash64A-style hash, processing 8-byte words:
+
+inline std::uint64_t hash_bytes( void const * ptr, size_t len, std::uint64_t seed = 0 ) span_noexcept
+{
+    std::uint64_t const m = 0xc6a4a7935bd1e995ULL;
+    int           const r = 47;
+
+    unsigned char const * data = static_cast<unsigned char const *>( ptr );
+    unsigned char const * last = data + ( len & ~size_t( 7 ) );
+
+    std::uint64_t h = seed ^ ( static_cast<std::uint64_t>( len ) * m );
+
+    for ( ; data != last; data += 8 )
+    {
+        std::uint64_t k;
+        std::memcpy( &k, data, sizeof( k ) );
+
+        k *= m;
+        k ^= k >> r;
+        k *= m;
+
+        h ^= k;
+        h *= m;
+    }
+
+    if ( size_t const rest = len & 7 )
+    {
+        std::uint64_t k = 0;
+        for ( size_t i = 0; i != rest; ++i )
+        {
+            k |= static_cast<std::uint64_t>( data[i] ) << ( 8 * i );
+        }
+        h ^= k;
+        h *= m;
+    }
+
+    h ^= h >> r;
+    h *= m;
+    h ^= h >> r;
+
+    return h;
+}
+
+inline std::uint64_t hash_combine( std::uint64_t h, std::uint64_t v ) span_noexcept
+{
+    return ( h ^ v ) * 0xc6a4a7935bd1e995ULL + 0x9e3779b97f4a7c15ULL;
+}
+
+template< class T >
+inline size_t hash_elements( T const * ptr, size_t len, std11::true_type ) span_noexcept
+{
+    return static_cast<size_t>( hash_bytes( ptr, len * sizeof( T ) ) );
+}
+
+template< class T >
+inline size_t hash_elements( T const * ptr, size_t len, std11::false_type )
+{
+    std::hash< typename std11::remove_cv< T >::type > hasher;
+
+    std::uint64_t h = static_cast<std::uint64_t>( len );
+    for ( size_t i = 0; i != len; ++i )
+    {
+        h = hash_combine( h, hasher( ptr[i] ) );
+    }
+    return static_cast<size_t>( hash_bytes( &h, sizeof( h ) ) );
+}
+
+}  // namespace detail
+
+// Content hash, consistent with span_equal (same element type, up to cv), but not
+// with operator==(), which also compares e.g. span<int> and span<long>; is transparent,
+// so that for example unordered_map<std::vector<T>, V, span_hash, span_equal>
+// can be probed with a span<const T> without creating a vector:
+
+struct span_hash
+{
+    typedef void is_transparent;
+    typedef size_t result_type;
+
+    template< class T, extent_t Extent >
+    size_t operator()( span<T, Extent> spn ) const
+    {
+        return detail::hash_elements( spn.data(), spn.size(),
+            std17::bool_constant< detail::is_bitwise_comparable< typename std11::remove_cv< T >::type >::value >() );
+    }
+
+#if span_HAVE( CONSTRAINED_SPAN_CONTAINER_CTOR ) || span_HAVE( DATA )
+    template< class Container >
+    auto operator()( Container const & cont ) const -> decltype( std17::data( cont ), size_t() )
+    {
+        return (*this)( span< typename std11::remove_reference< decltype( *std17::data( cont ) ) >::type >(
+            std17::data( cont ), to_size( std17::size( cont ) ) ) );
+    }
+#endif
+};
+
+// Content equality, consistent with span_hash; is transparent. The element
+// types must be the same but for cv: span_hash hashes int and long differently,
+// so spans of both may not compare equal:
+
+struct span_equal
+{
+    typedef void is_transparent;
+
+    template< class T1, extent_t E1, class T2, extent_t E2
+        span_REQUIRES_T((
+            std11::is_same< typename std11::remove_cv< T1 >::type, typename std11::remove_cv< T2 >::type >::value
+        ))
+    >
+    bool operator()( span<T1, E1> l, span<T2, E2> r ) const
+    {
+        return l.size() == r.size() && detail::equal_elements( l.data(), r.data(), l.size(),
+            std17::bool_constant< detail::is_memcmp_equality_comparable<T1, T2>::value >() );
+    }
+
+#if span_HAVE( CONSTRAINED_SPAN_CONTAINER_CTOR ) || span_HAVE( DATA )
+    template< class T, extent_t E, class Container >
+    auto operator()( span<T, E> l, Container const & r ) const -> decltype( std17::data( r ), bool() )
+    {
+        return (*this)( l, as_span( r ) );
+    }
+
+    template< class Container, class T, extent_t E >
+    auto operator()( Container const & l, span<T, E> r ) const -> decltype( std17::data( l ), bool() )
+    {
+        return (*this)( as_span( l ), r );
+    }
+
+    template< class Container1, class Container2 >
+    auto operator()( Container1 const & l, Container2 const & r ) const -> decltype( std17::data( l ), std17::data( r ), bool() )
+    {
+        return (*this)( as_span( l ), as_span( r ) );
+    }
+
+private:
+    template< class Container >
+    static auto as_span( Container const & cont ) -> span< typename std11::remove_reference< decltype( *std17::data( cont ) ) >::type >
+    {
+        return span< typename std11::remove_reference< decltype( *std17::data( cont ) ) >::type >(
+            std17::data( cont ), to_size( std17::size( cont ) ) );
+    }
+#endif
+};
+
+// Identity hash, consistent with same() and with span_identity_equal:
+
+struct span_identity_hash
+{
+    typedef size_t result_type;
+
+    template< class T, extent_t Extent >
+    size_t operator()( span<T, Extent> spn ) const span_noexcept
+    {
+        std::uint64_t const h = detail::hash_combine(
+            static_cast<std::uint64_t>( reinterpret_cast<std::uintptr_t>( spn.data() ) ), static_cast<std::uint64_t>( spn.size() ) );
+
+        return static_cast<size_t>( detail::hash_bytes( &h, sizeof( h ) ) );
+    }
+};
+
+// Identity equality: same element type, same data pointer and same size, as same():
+
+struct span_identity_equal
+{
+    template< class T1, extent_t E1, class T2, extent_t E2 >
+    bool operator()( span<T1, E1> l, span<T2, E2> r ) const span_noexcept
+    {
+        return std11::is_same< T1, T2 >::value
+            && l.size() == r.size()
+            && static_cast<void const *>( l.data() ) == r.data();
+    }
+};
+
+#endif // span_FEATURE( HASH )
+
 // 26.7.2.6 views of object representation [span.objectrep]
 
 #if span_HAVE( BYTE ) || span_HAVE( NONSTD_BYTE )
@@ -1547,53 +2423,4799 @@ span_constexpr std::ptrdiff_t ssize( span<T,Extent> const & spn )
     return static_cast<std::ptrdiff_t>( spn.size() );
 }
 
-}  // namespace span_lite
-}  // namespace nonstd
+// strided_span [span-lite extension]: a view on every stride-th element of a sequence:
 
-// make available in nonstd:
+#if span_FEATURE( STRIDED_SPAN )
 
-namespace nonstd {
+template< class T, extent_t Extent = dynamic_extent >
+class strided_span;
 
-using span_lite::dynamic_extent;
+// Note: the iterator keeps an index instead of a moving pointer,
+// to not form a pointer beyond the end of the underlying sequence.
 
-using span_lite::span;
+template< class T >
+class strided_iterator
+{
+public:
+    typedef std::random_access_iterator_tag iterator_category;
+    typedef typename std11::remove_cv< T >::type value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef T * pointer;
+    typedef T & reference;
 
-using span_lite::with_container;
+    span_constexpr strided_iterator() span_noexcept
+        : data_( span_nullptr )
+        , stride_( 1 )
+        , index_( 0 )
+    {}
 
-#if span_FEATURE( COMPARISON )
-#if span_FEATURE( SAME )
-using span_lite::same;
-#endif
+    span_constexpr strided_iterator( pointer ptr, difference_type stride, difference_type index ) span_noexcept
+        : data_( ptr )
+        , stride_( stride )
+        , index_( index )
+    {}
 
-using span_lite::operator==;
-using span_lite::operator!=;
-using span_lite::operator<;
-using span_lite::operator<=;
-using span_lite::operator>;
-using span_lite::operator>=;
-#endif
+    template< class U
+        span_REQUIRES_T((
+            std::is_convertible<U(*)[], T(*)[]>::value
+        ))
+    >
+    span_constexpr strided_iterator( strided_iterator<U> const & other ) span_noexcept
+        : data_( other.data_ )
+        , stride_( other.stride_ )
+        , index_( other.index_ )
+    {}
 
-#if span_HAVE( BYTE )
-using span_lite::as_bytes;
-using span_lite::as_writable_bytes;
-#endif
+    span_constexpr reference operator*() const span_noexcept
+    {
+        return data_[ index_ * stride_ ];
+    }
 
-using span_lite::size;
-using span_lite::ssize;
+    span_constexpr pointer operator->() const span_noexcept
+    {
+        return data_ + index_ * stride_;
+    }
 
-}  // namespace nonstd
+    span_constexpr reference operator[]( difference_type n ) const span_noexcept
+    {
+        return data_[ ( index_ + n ) * stride_ ];
+    }
 
-#endif  // span_USES_STD_SPAN
+    span_constexpr14 strided_iterator & operator++() span_noexcept
+    {
+        ++index_;
+        return *this;
+    }
 
-// make_span() [span-lite extension]:
+    span_constexpr14 strided_iterator operator++( int ) span_noexcept
+    {
+        strided_iterator result( *this );
+        ++index_;
+        return result;
+    }
 
-#if span_FEATURE( MAKE_SPAN ) || span_FEATURE( NON_MEMBER_FIRST_LAST_SUB_SPAN ) || span_FEATURE( NON_MEMBER_FIRST_LAST_SUB_CONTAINER )
+    span_constexpr14 strided_iterator & operator--() span_noexcept
+    {
+        --index_;
+        return *this;
+    }
 
-#if span_USES_STD_SPAN
-# define  span_constexpr  constexpr
-# define  span_noexcept   noexcept
-# define  span_nullptr    nullptr
-# ifndef  span_CONFIG_EXTENT_TYPE
+    span_constexpr14 strided_iterator operator--( int ) span_noexcept
+    {
+        strided_iterator result( *this );
+        --index_;
+        return result;
+    }
+
+    span_constexpr14 strided_iterator & operator+=( difference_type n ) span_noexcept
+    {
+        index_ += n;
+        return *this;
+    }
+
+    span_constexpr14 strided_iterator & operator-=( difference_type n ) span_noexcept
+    {
+        index_ -= n;
+        return *this;
+    }
+
+    friend span_constexpr strided_iterator operator+( strided_iterator it, difference_type n ) span_noexcept
+    {
+        return strided_iterator( it.data_, it.stride_, it.index_ + n );
+    }
+
+    friend span_constexpr strided_iterator operator+( difference_type n, strided_iterator it ) span_noexcept
+    {
+        return strided_iterator( it.data_, it.stride_, it.index_ + n );
+    }
+
+    friend span_constexpr strided_iterator operator-( strided_iterator it, difference_type n ) span_noexcept
+    {
+        return strided_iterator( it.data_, it.stride_, it.index_ - n );
+    }
+
+    friend span_constexpr difference_type operator-( strided_iterator const & a, strided_iterator const & b ) span_noexcept
+    {
+        return a.index_ - b.index_;
+    }
+
+    friend span_constexpr bool operator==( strided_iterator const & a, strided_iterator const & b ) span_noexcept
+    {
+        return a.index_ == b.index_;
+    }
+
+    friend span_constexpr bool operator!=( strided_iterator const & a, strided_iterator const & b ) span_noexcept
+    {
+        return a.index_ != b.index_;
+    }
+
+    friend span_constexpr bool operator<( strided_iterator const & a, strided_iterator const & b ) span_noexcept
+    {
+        return a.index_ < b.index_;
+    }
+
+    friend span_constexpr bool operator<=( strided_iterator const & a, strided_iterator const & b ) span_noexcept
+    {
+        return a.index_ <= b.index_;
+    }
+
+    friend span_constexpr bool operator>( strided_iterator const & a, strided_iterator const & b ) span_noexcept
+    {
+        return a.index_ > b.index_;
+    }
+
+    friend span_constexpr bool operator>=( strided_iterator const & a, strided_iterator const & b ) span_noexcept
+    {
+        return a.index_ >= b.index_;
+    }
+
+private:
+    template< class U > friend class strided_iterator;
+
+    pointer         data_;
+    difference_type stride_;
+    difference_type index_;
+};
+
+template< class T, extent_t Extent /*= dynamic_extent*/ >
+class strided_span
+{
+public:
+    typedef T element_type;
+    typedef typename std11::remove_cv< T >::type value_type;
+
+    typedef T &       reference;
+    typedef T *       pointer;
+    typedef T const * const_pointer;
+    typedef T const & const_reference;
+
+    typedef size_t    size_type;
+    typedef extent_t  extent_type;
+
+    typedef std::ptrdiff_t difference_type;
+
+    typedef strided_iterator< T >                   iterator;
+    typedef std::reverse_iterator< iterator >       reverse_iterator;
+
+    enum { extent = Extent };
+
+    span_REQUIRES_0(
+        ( Extent == 0 ) ||
+        ( Extent == dynamic_extent )
+    )
+    span_constexpr strided_span() span_noexcept
+        : storage_( span_nullptr, 0 )
+        , stride_( 1 )
+    {}
+
+    span_constexpr_exp strided_span( pointer ptr, size_type count, difference_type stride )
+        : storage_( ptr, count )
+        , stride_( stride )
+    {
+        span_EXPECTS( stride > 0 );
+        span_EXPECTS(
+            ( ptr == span_nullptr && count == 0 ) ||
+            ( ptr != span_nullptr && detail::is_positive( count ) )
+        );
+        span_EXPECTS( Extent == dynamic_extent || count == to_size( Extent ) );
+    }
+
+    template< class OtherElementType, extent_type OtherExtent
+        span_REQUIRES_T((
+            (Extent == dynamic_extent || OtherExtent == dynamic_extent || Extent == OtherExtent)
+            && std::is_convertible<OtherElementType(*)[], element_type(*)[]>::value
+        ))
+    >
+    span_constexpr_exp strided_span( span<OtherElementType, OtherExtent> const & other )
+        : storage_( other.data(), other.size() )
+        , stride_( 1 )
+    {
+        span_EXPECTS( Extent == dynamic_extent || other.size() == to_size(Extent) );
+    }
+
+    template< class OtherElementType, extent_type OtherExtent
+        span_REQUIRES_T((
+            (Extent == dynamic_extent || OtherExtent == dynamic_extent || Extent == OtherExtent)
+            && std::is_convertible<OtherElementType(*)[], element_type(*)[]>::value
+        ))
+    >
+    span_constexpr_exp strided_span( strided_span<OtherElementType, OtherExtent> const & other )
+        : storage_( other.data(), other.size() )
+        , stride_( other.stride() )
+    {
+        span_EXPECTS( Extent == dynamic_extent || other.size() == to_size(Extent) );
+    }
+
+    // subviews:
+
+    template< extent_type Count >
+    span_constexpr_exp strided_span< element_type, Count >
+    first() const
+    {
+        span_EXPECTS( detail::is_positive( Count ) && Count <= size() );
+
+        return strided_span< element_type, Count >( data(), Count, stride() );
+    }
+
+    template< extent_type Count >
+    span_constexpr_exp strided_span< element_type, Count >
+    last() const
+    {
+        span_EXPECTS( detail::is_positive( Count ) && Count <= size() );
+
+        return strided_span< element_type, Count >( start_at( size() - Count ), Count, stride() );
+    }
+
+#if span_HAVE( DEFAULT_FUNCTION_TEMPLATE_ARG )
+    template< size_type Offset, extent_type Count = dynamic_extent >
+#else
+    template< size_type Offset, extent_type Count /*= dynamic_extent*/ >
+#endif
+    span_constexpr_exp strided_span< element_type, Count >
+    subspan() const
+    {
+        span_EXPECTS(
+            ( detail::is_positive( Offset ) && Offset <= size() ) &&
+            ( Count == dynamic_extent || (detail::is_positive( Count ) && Count + Offset <= size()) )
+        );
+
+        return strided_span< element_type, Count >(
+            start_at( Offset ), Count != dynamic_extent ? Count : size() - Offset, stride() );
+    }
+
+    span_constexpr_exp strided_span< element_type, dynamic_extent >
+    first( size_type count ) const
+    {
+        span_EXPECTS( detail::is_positive( count ) && count <= size() );
+
+        return strided_span< element_type, dynamic_extent >( data(), count, stride() );
+    }
+
+    span_constexpr_exp strided_span< element_type, dynamic_extent >
+    last( size_type count ) const
+    {
+        span_EXPECTS( detail::is_positive( count ) && count <= size() );
+
+        return strided_span< element_type, dynamic_extent >( start_at( size() - count ), count, stride() );
+    }
+
+    span_constexpr_exp strided_span< element_type, dynamic_extent >
+    subspan( size_type offset, size_type count = static_cast<size_type>(dynamic_extent) ) const
+    {
+        span_EXPECTS(
+            ( ( detail::is_positive( offset ) && offset <= size() ) ) &&
+            ( count == static_cast<size_type>(dynamic_extent) || ( detail::is_positive( count ) && offset + count <= size() ) )
+        );
+
+        return strided_span< element_type, dynamic_extent >(
+            start_at( offset ), count == static_cast<size_type>(dynamic_extent) ? size() - offset : count, stride() );
+    }
+
+    // observers:
+
+    span_constexpr size_type size() const span_noexcept
+    {
+        return storage_.size();
+    }
+
+    span_constexpr difference_type stride() const span_noexcept
+    {
+        return stride_;
+    }
+
+    span_nodiscard span_constexpr bool empty() const span_noexcept
+    {
+        return size() == 0;
+    }
+
+    // element access:
+
+    span_constexpr_exp reference operator[]( size_type idx ) const
+    {
+        span_EXPECTS( detail::is_positive( idx ) && idx < size() );
+
+        return *at_index( idx );
+    }
+
+    span_constexpr pointer data() const span_noexcept
+    {
+        return storage_.data_;
+    }
+
+    span_constexpr_exp reference front() const
+    {
+        span_EXPECTS( ! empty() );
+
+        return *data();
+    }
+
+    span_constexpr_exp reference back() const
+    {
+        span_EXPECTS( ! empty() );
+
+        return *at_index( size() - 1 );
+    }
+
+    // iterator support:
+
+    span_constexpr iterator begin() const span_noexcept
+    {
+        return iterator( data(), stride(), 0 );
+    }
+
+    span_constexpr iterator end() const span_noexcept
+    {
+        return iterator( data(), stride(), static_cast<difference_type>( size() ) );
+    }
+
+    span_constexpr reverse_iterator rbegin() const span_noexcept
+    {
+        return reverse_iterator( end() );
+    }
+
+    span_constexpr reverse_iterator rend() const span_noexcept
+    {
+        return reverse_iterator( begin() );
+    }
+
+private:
+    span_constexpr pointer at_index( size_type idx ) const span_noexcept
+    {
+        return data() + static_cast<difference_type>( idx ) * stride();
+    }
+
+    // start of a subview at idx <= size(); an empty subview at the end starts
+    // at data(), as data() + size() * stride() may lie past the end of the array:
+
+    span_constexpr pointer start_at( size_type idx ) const span_noexcept
+    {
+        return idx < size() ? at_index( idx ) : data();
+    }
+
+    detail::span_storage< element_type, Extent > storage_;
+    difference_type stride_;
+};
+
+// stride(): view every n-th element of a span or strided span:
+
+template< class T, extent_t Extent >
+inline span_constexpr_exp strided_span<T>
+stride( span<T, Extent> spn, std::ptrdiff_t n )
+{
+    span_EXPECTS( n > 0 );
+
+    return strided_span<T>( spn.data(), ( spn.size() + to_size( n ) - 1 ) / to_size( n ), n );
+}
+
+template< class T, extent_t Extent >
+inline span_constexpr_exp strided_span<T>
+stride( strided_span<T, Extent> spn, std::ptrdiff_t n )
+{
+    span_EXPECTS( n > 0 );
+    span_EXPECTS( n <= std::numeric_limits< std::ptrdiff_t >::max() / spn.stride() );
+
+    return strided_span<T>( spn.data(), ( spn.size() + to_size( n ) - 1 ) / to_size( n ), n * spn.stride() );
+}
+
+#endif // span_FEATURE( STRIDED_SPAN )
+
+// Alignment helpers for extensions:
+
+#if span_FEATURE( ALIGNED_SPAN ) || span_FEATURE( MAPPED_FILE ) || span_FEATURE( MONOTONIC_ARENA ) || span_FEATURE( SPAN_VECTOR ) || span_FEATURE( AS_SPAN )
+
+namespace detail {
+
+#if span_CPP11_120
+typedef std::uintptr_t uintptr_type;
+#else
+typedef size_t uintptr_type;
+#endif
+
+// Note: alignment cannot be determined during constant evaluation.
+
+inline span_constexpr20 bool is_aligned( void const * ptr, size_t alignment ) span_noexcept
+{
+#if span_HAVE( IS_CONSTANT_EVALUATED )
+    if ( std::is_constant_evaluated() )
+    {
+        return true;
+    }
+#endif
+    return reinterpret_cast< uintptr_type >( ptr ) % alignment == 0;
+}
+
+template< class T >
+struct alignment_of
+{
+#if span_HAVE( TYPE_TRAITS )
+    enum { value = std::alignment_of< T >::value };
+#else
+    struct padded { char c; T t; };
+    enum { value = sizeof( padded ) - sizeof( T ) };
+#endif
+};
+
+}  // namespace detail
+
+#endif // span_FEATURE( ALIGNED_SPAN ) || span_FEATURE( MAPPED_FILE ) || span_FEATURE( MONOTONIC_ARENA ) || span_FEATURE( SPAN_VECTOR ) || span_FEATURE( AS_SPAN )
+
+// as_span<U>(), as_writable_span<U>() [span-lite extension]: view a span of bytes as
+// elements of type U; the inverse of as_bytes() and as_writable_bytes():
+
+#if span_FEATURE( AS_SPAN ) || span_HAVE( MAPPED_FILE )
+
+template< typename U, extent_t Extent >
+struct ElementsExtent
+{
+#if span_CPP11_OR_GREATER
+    enum ET : extent_t { value = Extent / span_sizeof(U) };
+#else
+    enum ET { value = Extent / span_sizeof(U) };
+#endif
+};
+
+template< typename U >
+struct ElementsExtent< U, dynamic_extent >
+{
+#if span_CPP11_OR_GREATER
+    enum ET : extent_t { value = dynamic_extent };
+#else
+    enum ET { value = dynamic_extent };
+#endif
+};
+
+// The data must be aligned for U and the size must be a multiple of sizeof(U);
+// for a static extent, the size is checked during compilation:
+
+template< class U, class B, extent_t Extent >
+inline span< U const, ElementsExtent<U, Extent>::value >
+as_span( span< B, Extent > bytes )
+{
+#if span_HAVE( STATIC_ASSERT )
+    static_assert( sizeof( B ) == 1, "as_span<U>(): B must be a byte type, e.g. std::byte const" );
+    static_assert( Extent == dynamic_extent || Extent % span_sizeof(U) == 0, "as_span<U>(): Extent must be a multiple of sizeof(U)" );
+#endif
+    span_EXPECTS( detail::is_aligned( bytes.data(), detail::alignment_of< U >::value ) && bytes.size() % sizeof( U ) == 0 );
+
+    return span< U const, ElementsExtent<U, Extent>::value >(
+        reinterpret_cast< U const * >( bytes.data() ), bytes.size() / sizeof( U ) );  // NOLINT
+}
+
+template< class U, class B, extent_t Extent >
+inline span< U, ElementsExtent<U, Extent>::value >
+as_writable_span( span< B, Extent > bytes )
+{
+#if span_HAVE( STATIC_ASSERT )
+    static_assert( sizeof( B ) == 1, "as_writable_span<U>(): B must be a byte type, e.g. std::byte" );
+    static_assert( Extent == dynamic_extent || Extent % span_sizeof(U) == 0, "as_writable_span<U>(): Extent must be a multiple of sizeof(U)" );
+#endif
+    span_EXPECTS( detail::is_aligned( bytes.data(), detail::alignment_of< U >::value ) && bytes.size() % sizeof( U ) == 0 );
+
+    return span< U, ElementsExtent<U, Extent>::value >(
+        reinterpret_cast< U * >( bytes.data() ), bytes.size() / sizeof( U ) );  // NOLINT
+}
+
+#endif // span_FEATURE( AS_SPAN ) || span_HAVE( MAPPED_FILE )
+
+// aligned_span [span-lite extension]: a span of which the data is aligned to Alignment bytes:
+
+#if span_FEATURE( ALIGNED_SPAN )
+
+namespace detail {
+
+template< size_t Alignment, class T >
+inline span_constexpr20 T * assume_aligned( T * ptr ) span_noexcept
+{
+#if span_HAVE( IS_CONSTANT_EVALUATED )
+    if ( std::is_constant_evaluated() )
+    {
+        return ptr;
+    }
+#endif
+#if span_HAVE( BUILTIN_ASSUME_ALIGNED )
+    return static_cast< T * >( __builtin_assume_aligned( ptr, Alignment ) );
+#else
+    return ptr;
+#endif
+}
+
+}  // namespace detail
+
+template< class T, size_t Alignment, extent_t Extent = dynamic_extent >
+class aligned_span
+{
+#if span_HAVE( STATIC_ASSERT )
+    static_assert( Alignment > 0 && ( Alignment & ( Alignment - 1 ) ) == 0, "aligned_span<>: Alignment must be a power of two" );
+#endif
+
+public:
+    typedef T element_type;
+    typedef typename std11::remove_cv< T >::type value_type;
+
+    typedef T &       reference;
+    typedef T *       pointer;
+    typedef T const * const_pointer;
+    typedef T const & const_reference;
+
+    typedef size_t    size_type;
+    typedef extent_t  extent_type;
+
+    typedef pointer   iterator;
+    typedef std::reverse_iterator< iterator > reverse_iterator;
+
+    typedef std::ptrdiff_t difference_type;
+
+    enum { extent = Extent };
+    enum { alignment = Alignment };
+
+    span_REQUIRES_0(
+        ( Extent == 0 ) ||
+        ( Extent == dynamic_extent )
+    )
+    span_constexpr aligned_span() span_noexcept
+        : storage_( span_nullptr, 0 )
+    {}
+
+    span_constexpr20 aligned_span( pointer ptr, size_type count )
+        : storage_( ptr, count )
+    {
+        span_EXPECTS( detail::is_aligned( ptr, Alignment ) );
+        span_EXPECTS(
+            ( ptr == span_nullptr && count == 0 ) ||
+            ( ptr != span_nullptr && detail::is_positive( count ) )
+        );
+        span_EXPECTS( Extent == dynamic_extent || count == to_size( Extent ) );
+    }
+
+    template< class OtherElementType, extent_type OtherExtent
+        span_REQUIRES_T((
+            (Extent == dynamic_extent || OtherExtent == dynamic_extent || Extent == OtherExtent)
+            && std::is_convertible<OtherElementType(*)[], element_type(*)[]>::value
+        ))
+    >
+    span_constexpr20 explicit aligned_span( span<OtherElementType, OtherExtent> const & other )
+        : storage_( other.data(), other.size() )
+    {
+        span_EXPECTS( detail::is_aligned( other.data(), Alignment ) );
+        span_EXPECTS( Extent == dynamic_extent || other.size() == to_size(Extent) );
+    }
+
+    // An aligned_span converts to one of the same or a weaker alignment:
+
+    template< class OtherElementType, size_t OtherAlignment, extent_type OtherExtent
+        span_REQUIRES_T((
+            (Extent == dynamic_extent || OtherExtent == dynamic_extent || Extent == OtherExtent)
+            && OtherAlignment % Alignment == 0
+            && std::is_convertible<OtherElementType(*)[], element_type(*)[]>::value
+        ))
+    >
+    span_constexpr_exp aligned_span( aligned_span<OtherElementType, OtherAlignment, OtherExtent> const & other )
+        : storage_( other.as_span().data(), other.size() )
+    {
+        span_EXPECTS( OtherAlignment % Alignment == 0 );
+        span_EXPECTS( Extent == dynamic_extent || other.size() == to_size(Extent) );
+    }
+
+    // conversion to span; since C++11 via span's constructor from a container:
+
+    span_constexpr span< element_type, Extent > as_span() const span_noexcept
+    {
+        return span< element_type, Extent >( detail::unchecked, storage_.data_, size() );
+    }
+
+#if ! span_HAVE( CONSTRAINED_SPAN_CONTAINER_CTOR )
+    operator span< element_type, Extent >() const span_noexcept
+    {
+        return as_span();
+    }
+#endif
+
+    // subviews; first() retains the alignment, last() and subspan() do not:
+
+    template< extent_type Count >
+    span_constexpr_exp aligned_span< element_type, Alignment, Count >
+    first() const
+    {
+        span_EXPECTS( detail::is_positive( Count ) && Count <= size() );
+
+        return aligned_span< element_type, Alignment, Count >( detail::unchecked, storage_.data_, Count );
+    }
+
+    span_constexpr_exp aligned_span< element_type, Alignment >
+    first( size_type count ) const
+    {
+        span_EXPECTS( detail::is_positive( count ) && count <= size() );
+
+        return aligned_span< element_type, Alignment >( detail::unchecked, storage_.data_, count );
+    }
+
+    span_constexpr_exp span< element_type >
+    last( size_type count ) const
+    {
+        return as_span().last( count );
+    }
+
+    span_constexpr_exp span< element_type >
+    subspan( size_type offset, size_type count = static_cast<size_type>(dynamic_extent) ) const
+    {
+        return as_span().subspan( offset, count );
+    }
+
+    // observers:
+
+    span_constexpr size_type size() const span_noexcept
+    {
+        return storage_.size();
+    }
+
+    span_constexpr size_type size_bytes() const span_noexcept
+    {
+        return size() * to_size( sizeof( element_type ) );
+    }
+
+    span_nodiscard span_constexpr bool empty() const span_noexcept
+    {
+        return size() == 0;
+    }
+
+    // element access:
+
+    span_constexpr20 reference operator[]( size_type idx ) const
+    {
+        span_EXPECTS( detail::is_positive( idx ) && idx < size() );
+
+        return *( data() + idx );
+    }
+
+    span_constexpr20 pointer data() const span_noexcept
+    {
+        return detail::assume_aligned< Alignment >( storage_.data_ );
+    }
+
+    span_constexpr_exp reference front() const
+    {
+        span_EXPECTS( ! empty() );
+
+        return *storage_.data_;
+    }
+
+    span_constexpr_exp reference back() const
+    {
+        span_EXPECTS( ! empty() );
+
+        return *( storage_.data_ + ( size() - 1 ) );
+    }
+
+    // iterator support:
+
+    span_constexpr20 iterator begin() const span_noexcept
+    {
+        return data();
+    }
+
+    span_constexpr20 iterator end() const span_noexcept
+    {
+        return data() + size();
+    }
+
+    span_constexpr20 reverse_iterator rbegin() const span_noexcept
+    {
+        return reverse_iterator( end() );
+    }
+
+    span_constexpr20 reverse_iterator rend() const span_noexcept
+    {
+        return reverse_iterator( begin() );
+    }
+
+private:
+    template< class U, size_t A, extent_t E > friend class aligned_span;
+
+    span_constexpr aligned_span( detail::unchecked_t, pointer ptr, size_type count ) span_noexcept
+        : storage_( ptr, count )
+    {}
+
+    detail::span_storage< element_type, Extent > storage_;
+};
+
+// make_aligned_span(): view a span as aligned_span, checking its alignment once:
+
+template< size_t Alignment, class T, extent_t Extent >
+inline span_constexpr20 aligned_span< T, Alignment, Extent >
+make_aligned_span( span< T, Extent > spn )
+{
+    return aligned_span< T, Alignment, Extent >( spn );
+}
+
+#endif // span_FEATURE( ALIGNED_SPAN )
+
+// noalias_span [span-lite extension]: a span through which its elements are accessed exclusively:
+
+#if span_FEATURE( NOALIAS_SPAN )
+
+// overlaps(): true if two spans share at least one byte; empty spans overlap nothing.
+// Note: std::less provides a total order also for pointers into different objects.
+
+template< class T1, extent_t E1, class T2, extent_t E2 >
+inline bool overlaps( span<T1, E1> const & a, span<T2, E2> const & b ) span_noexcept
+{
+    typedef void const volatile * address;
+
+    unsigned char const volatile * const a_first = reinterpret_cast< unsigned char const volatile * >( a.data() );
+    unsigned char const volatile * const b_first = reinterpret_cast< unsigned char const volatile * >( b.data() );
+
+    std::less< address > less;
+
+    return ! a.empty() && ! b.empty()
+        && less( address( a_first ), address( b_first + b.size_bytes() ) )
+        && less( address( b_first ), address( a_first + a.size_bytes() ) );
+}
+
+// The data pointer is restrict-qualified, so that a kernel taking several noalias_span
+// parameters compiles as if it took restrict-qualified pointers. As with restrict, an
+// element accessed via a noalias_span must not be accessed otherwise while it is in use.
+
+template< class T >
+class noalias_span
+{
+public:
+    typedef T element_type;
+    typedef typename std11::remove_cv< T >::type value_type;
+
+    typedef T &       reference;
+    typedef T *       pointer;
+    typedef T const * const_pointer;
+    typedef T const & const_reference;
+
+    typedef size_t    size_type;
+    typedef extent_t  extent_type;
+
+    typedef pointer   iterator;
+    typedef std::reverse_iterator< iterator > reverse_iterator;
+
+    typedef std::ptrdiff_t difference_type;
+
+    span_constexpr noalias_span() span_noexcept
+        : data_( span_nullptr )
+        , size_( 0 )
+    {}
+
+    span_constexpr_exp noalias_span( pointer ptr, size_type count )
+        : data_( ptr )
+        , size_( count )
+    {
+        span_EXPECTS(
+            ( ptr == span_nullptr && count == 0 ) ||
+            ( ptr != span_nullptr && detail::is_positive( count ) )
+        );
+    }
+
+    template< class OtherElementType, extent_type OtherExtent
+        span_REQUIRES_T((
+            std::is_convertible<OtherElementType(*)[], element_type(*)[]>::value
+        ))
+    >
+    span_constexpr explicit noalias_span( span<OtherElementType, OtherExtent> const & other ) span_noexcept
+        : data_( other.data() )
+        , size_( other.size() )
+    {}
+
+    // conversion to span; since C++11 also via span's constructor from a container:
+
+    span_constexpr span< element_type > as_span() const span_noexcept
+    {
+        return span< element_type >( detail::unchecked, data_, size_ );
+    }
+
+    // observers:
+
+    span_constexpr size_type size() const span_noexcept
+    {
+        return size_;
+    }
+
+    span_constexpr size_type size_bytes() const span_noexcept
+    {
+        return size() * to_size( sizeof( element_type ) );
+    }
+
+    span_nodiscard span_constexpr bool empty() const span_noexcept
+    {
+        return size() == 0;
+    }
+
+    // element access:
+
+    span_constexpr_exp reference operator[]( size_type idx ) const
+    {
+        span_EXPECTS( detail::is_positive( idx ) && idx < size() );
+
+        return data_[ idx ];
+    }
+
+    span_constexpr pointer data() const span_noexcept
+    {
+        return data_;
+    }
+
+    // iterator support:
+
+    span_constexpr iterator begin() const span_noexcept
+    {
+        return data_;
+    }
+
+    span_constexpr iterator end() const span_noexcept
+    {
+        return data_ + size_;
+    }
+
+    span_constexpr reverse_iterator rbegin() const span_noexcept
+    {
+        return reverse_iterator( end() );
+    }
+
+    span_constexpr reverse_iterator rend() const span_noexcept
+    {
+        return reverse_iterator( begin() );
+    }
+
+private:
+    pointer span_RESTRICT data_;
+    size_type size_;
+};
+
+template< class T1, class T2 >
+inline bool overlaps( noalias_span<T1> const & a, noalias_span<T2> const & b ) span_noexcept
+{
+    return overlaps( a.as_span(), b.as_span() );
+}
+
+// make_noalias_span(): view a span as noalias_span:
+
+template< class T, extent_t Extent >
+inline span_constexpr noalias_span< T >
+make_noalias_span( span< T, Extent > spn ) span_noexcept
+{
+    return noalias_span< T >( spn );
+}
+
+#endif // span_FEATURE( NOALIAS_SPAN )
+
+// bit_span [span-lite extension]: a view on a sequence of bits stored in unsigned words:
+
+#if span_FEATURE( BIT_SPAN )
+
+namespace detail {
+
+template< class Word >
+inline span_constexpr size_t bits_per_word() span_noexcept
+{
+    return CHAR_BIT * sizeof( Word );
+}
+
+// word with the lower n bits set, 0 < n <= bits_per_word:
+
+template< class Word >
+inline span_constexpr Word low_bits( size_t n ) span_noexcept
+{
+    return n >= bits_per_word< Word >() ? static_cast< Word >( ~Word( 0 ) ) : static_cast< Word >( ( Word( 1 ) << n ) - 1u );
+}
+
+template< class Word >
+inline int popcount( Word word ) span_noexcept
+{
+#if span_HAVE( BITOPS )
+    return std::popcount( word );
+#elif span_HAVE( BUILTIN_POPCOUNT )
+    return sizeof( Word ) <= sizeof( unsigned int  ) ? __builtin_popcount ( static_cast< unsigned int  >( word ) )
+         : sizeof( Word ) <= sizeof( unsigned long ) ? __builtin_popcountl( static_cast< unsigned long >( word ) )
+         :                                             __builtin_popcountll( word );
+#else
+    int count = 0;
+    for ( ; word != 0; ++count )
+    {
+        word = static_cast< Word >( word & ( word - 1u ) );
+    }
+    return count;
+#endif
+}
+
+// number of trailing zero bits of a non-zero word:
+
+template< class Word >
+inline int countr_zero( Word word ) span_noexcept
+{
+#if span_HAVE( BITOPS )
+    return std::countr_zero( word );
+#elif span_HAVE( BUILTIN_POPCOUNT )
+    return sizeof( Word ) <= sizeof( unsigned int  ) ? __builtin_ctz ( static_cast< unsigned int  >( word ) )
+         : sizeof( Word ) <= sizeof( unsigned long ) ? __builtin_ctzl( static_cast< unsigned long >( word ) )
+         :                                             __builtin_ctzll( word );
+#else
+    int count = 0;
+    for ( ; ( word & 1u ) == 0; ++count )
+    {
+        word = static_cast< Word >( word >> 1 );
+    }
+    return count;
+#endif
+}
+
+}  // namespace detail
+
+// Proxy for a single bit of a word:
+
+template< class Word >
+class bit_reference
+{
+public:
+    span_constexpr bit_reference( Word * word, Word mask ) span_noexcept
+        : word_( word )
+        , mask_( mask )
+    {}
+
+    // a copy refers to the same bit, whereas assignment writes the bit:
+
+    span_constexpr bit_reference( bit_reference const & other ) span_noexcept
+        : word_( other.word_ )
+        , mask_( other.mask_ )
+    {}
+
+    span_constexpr operator bool() const span_noexcept
+    {
+        return ( *word_ & mask_ ) != 0;
+    }
+
+    span_constexpr bool operator~() const span_noexcept
+    {
+        return ( *word_ & mask_ ) == 0;
+    }
+
+    span_constexpr14 bit_reference const & operator=( bool value ) const span_noexcept
+    {
+        *word_ = static_cast< Word >( value ? *word_ | mask_ : *word_ & ~mask_ );
+        return *this;
+    }
+
+    span_constexpr14 bit_reference const & operator=( bit_reference const & other ) const span_noexcept
+    {
+        return *this = static_cast< bool >( other );
+    }
+
+    span_constexpr14 bit_reference const & flip() const span_noexcept
+    {
+        *word_ = static_cast< Word >( *word_ ^ mask_ );
+        return *this;
+    }
+
+private:
+    Word * word_;
+    Word   mask_;
+};
+
+namespace detail {
+
+template< class Word > struct bit_reference_type               { typedef bit_reference< Word > type; };
+template< class Word > struct bit_reference_type< Word const > { typedef bool type; };
+
+}  // namespace detail
+
+template< class Word >
+class bit_span;
+
+namespace detail {
+
+template< class Word1, class Word2, class Op >
+inline void bitwise_assign( bit_span< Word1 > const & dst, bit_span< Word2 > const & src, Op op );
+
+}  // namespace detail
+
+// Bits are numbered from the least significant bit of the first word on.
+// Algorithms process a word's worth of bits at a time, also for a bit_span
+// that does not start at a word boundary.
+
+template< class Word >
+class bit_span
+{
+#if span_HAVE( STATIC_ASSERT ) && span_HAVE( TYPE_TRAITS )
+    static_assert( std::is_unsigned< Word >::value, "bit_span<>: Word must be an unsigned integer type" );
+#endif
+
+public:
+    typedef Word word_type;
+    typedef typename std11::remove_cv< Word >::type value_word_type;
+
+    typedef size_t size_type;
+    typedef typename detail::bit_reference_type< Word >::type reference;
+
+    span_constexpr bit_span() span_noexcept
+        : words_()
+        , offset_( 0 )
+        , size_( 0 )
+    {}
+
+    template< extent_t Extent >
+    span_constexpr explicit bit_span( span< Word, Extent > words ) span_noexcept
+        : words_( words )
+        , offset_( 0 )
+        , size_( words.size() * word_bits() )
+    {}
+
+    template< extent_t Extent >
+    span_constexpr_exp bit_span( span< Word, Extent > words, size_type offset, size_type count )
+        : words_( words.data() + offset / word_bits(), words.size() - offset / word_bits() )
+        , offset_( offset % word_bits() )
+        , size_( count )
+    {
+        span_EXPECTS( offset <= words.size() * word_bits() && count <= words.size() * word_bits() - offset );
+    }
+
+    template< class OtherWord
+        span_REQUIRES_T((
+            std::is_convertible<OtherWord(*)[], Word(*)[]>::value
+        ))
+    >
+    span_constexpr bit_span( bit_span< OtherWord > const & other ) span_noexcept
+        : words_( other.words() )
+        , offset_( other.offset() )
+        , size_( other.size() )
+    {}
+
+    // subviews:
+
+    span_constexpr_exp bit_span first( size_type count ) const
+    {
+        span_EXPECTS( count <= size() );
+
+        return bit_span( words_, offset_, count );
+    }
+
+    span_constexpr_exp bit_span last( size_type count ) const
+    {
+        span_EXPECTS( count <= size() );
+
+        return bit_span( words_, offset_ + size() - count, count );
+    }
+
+    span_constexpr_exp bit_span subspan( size_type offset, size_type count = static_cast<size_type>(dynamic_extent) ) const
+    {
+        span_EXPECTS(
+            ( offset <= size() ) &&
+            ( count == static_cast<size_type>(dynamic_extent) || count <= size() - offset )
+        );
+
+        return bit_span( words_, offset_ + offset, count == static_cast<size_type>(dynamic_extent) ? size() - offset : count );
+    }
+
+    // observers:
+
+    span_constexpr size_type size() const span_noexcept
+    {
+        return size_;
+    }
+
+    span_nodiscard span_constexpr bool empty() const span_noexcept
+    {
+        return size() == 0;
+    }
+
+    // the words that contain the bits and the position of the first bit in the first word:
+
+    span_constexpr span< Word > words() const span_noexcept
+    {
+        return words_;
+    }
+
+    span_constexpr size_type offset() const span_noexcept
+    {
+        return offset_;
+    }
+
+    // element access:
+
+    span_constexpr_exp reference operator[]( size_type idx ) const
+    {
+        span_EXPECTS( idx < size() );
+
+        return reference_at( offset_ + idx, static_cast< Word * >( span_nullptr ) );
+    }
+
+    span_constexpr_exp bool test( size_type idx ) const
+    {
+        span_EXPECTS( idx < size() );
+
+        return reference_at( offset_ + idx, static_cast< Word const * >( span_nullptr ) );
+    }
+
+    span_constexpr14 void set( size_type idx, bool value = true ) const
+    {
+        span_EXPECTS( idx < size() );
+
+        ( *this )[ idx ] = value;
+    }
+
+    span_constexpr14 void reset( size_type idx ) const
+    {
+        set( idx, false );
+    }
+
+    span_constexpr14 void flip( size_type idx ) const
+    {
+        span_EXPECTS( idx < size() );
+
+        ( *this )[ idx ].flip();
+    }
+
+    // the count <= word_bits() bits at position pos in the lower bits of a word:
+
+    span_constexpr_exp value_word_type get_bits( size_type pos, size_type count ) const
+    {
+        span_EXPECTS( 0 < count && count <= word_bits() && pos <= size() && count <= size() - pos );
+
+        return load( pos, count );
+    }
+
+    // replace the count <= word_bits() bits at position pos with the lower bits of value:
+
+    span_constexpr14 void set_bits( size_type pos, size_type count, value_word_type value ) const
+    {
+        span_EXPECTS( 0 < count && count <= word_bits() && pos <= size() && count <= size() - pos );
+
+        store( pos, count, value );
+    }
+
+    // algorithms:
+
+    size_type count() const span_noexcept
+    {
+        size_type result = 0;
+
+        for ( size_type pos = 0; pos < size(); pos += word_bits() )
+        {
+            result += static_cast< size_type >( detail::popcount( load( pos, chunk( pos ) ) ) );
+        }
+        return result;
+    }
+
+    bool any() const span_noexcept
+    {
+        for ( size_type pos = 0; pos < size(); pos += word_bits() )
+        {
+            if ( load( pos, chunk( pos ) ) != 0 )
+                return true;
+        }
+        return false;
+    }
+
+    bool all() const span_noexcept
+    {
+        for ( size_type pos = 0; pos < size(); pos += word_bits() )
+        {
+            if ( load( pos, chunk( pos ) ) != detail::low_bits< value_word_type >( chunk( pos ) ) )
+                return false;
+        }
+        return true;
+    }
+
+    bool none() const span_noexcept
+    {
+        return ! any();
+    }
+
+    // index of the first set bit, or size() if there is none:
+
+    size_type find_first() const span_noexcept
+    {
+        return find_from( 0 );
+    }
+
+    // index of the first set bit after pos, or size() if there is none:
+
+    size_type find_next( size_type pos ) const span_noexcept
+    {
+        return pos < size() ? find_from( pos + 1 ) : size();
+    }
+
+private:
+    static span_constexpr size_type word_bits() span_noexcept
+    {
+        return detail::bits_per_word< Word >();
+    }
+
+    span_constexpr size_type chunk( size_type pos ) const span_noexcept
+    {
+        return size() - pos < word_bits() ? size() - pos : word_bits();
+    }
+
+    span_constexpr14 value_word_type load( size_type pos, size_type count ) const span_noexcept
+    {
+        size_type const bit  = ( offset_ + pos ) % word_bits();
+        Word    * const word = words_.data() + ( offset_ + pos ) / word_bits();
+
+        value_word_type bits = static_cast< value_word_type >( word[0] >> bit );
+
+        if ( bit != 0 && bit + count > word_bits() )
+        {
+            bits = static_cast< value_word_type >( bits | ( word[1] << ( word_bits() - bit ) ) );
+        }
+        return static_cast< value_word_type >( bits & detail::low_bits< value_word_type >( count ) );
+    }
+
+    span_constexpr14 void store( size_type pos, size_type count, value_word_type value ) const span_noexcept
+    {
+        size_type const bit  = ( offset_ + pos ) % word_bits();
+        Word    * const word = words_.data() + ( offset_ + pos ) / word_bits();
+
+        value_word_type const mask = detail::low_bits< value_word_type >( count );
+
+        word[0] = static_cast< Word >( ( word[0] & ~( mask << bit ) ) | ( ( value & mask ) << bit ) );
+
+        if ( bit != 0 && bit + count > word_bits() )
+        {
+            value_word_type const high = detail::low_bits< value_word_type >( bit + count - word_bits() );
+
+            word[1] = static_cast< Word >( ( word[1] & ~high ) | ( ( value >> ( word_bits() - bit ) ) & high ) );
+        }
+    }
+
+    size_type find_from( size_type pos ) const span_noexcept
+    {
+        for ( ; pos < size(); pos += word_bits() )
+        {
+            value_word_type const bits = load( pos, chunk( pos ) );
+
+            if ( bits != 0 )
+                return pos + static_cast< size_type >( detail::countr_zero( bits ) );
+        }
+        return size();
+    }
+
+    // select reference type: bit_reference for mutable words, bool for const words:
+
+    template< class W >
+    span_constexpr bit_reference< W > reference_at( size_type bit, W * ) const span_noexcept
+    {
+        return bit_reference< W >( words_.data() + bit / word_bits(), static_cast< W >( W( 1 ) << ( bit % word_bits() ) ) );
+    }
+
+    template< class W >
+    span_constexpr bool reference_at( size_type bit, W const * ) const span_noexcept
+    {
+        return ( ( words_.data()[ bit / word_bits() ] >> ( bit % word_bits() ) ) & 1 ) != 0;
+    }
+
+    // word-wise algorithms on two bit spans use the unchecked load() and store():
+
+    template< class Word1, class Word2, class Op >
+    friend void detail::bitwise_assign( bit_span< Word1 > const & dst, bit_span< Word2 > const & src, Op op );
+
+    span< Word > words_;
+    size_type    offset_;
+    size_type    size_;
+};
+
+namespace detail {
+
+struct bit_and { template< class W > W operator()( W a, W b ) const { return static_cast< W >( a & b ); } };
+struct bit_or  { template< class W > W operator()( W a, W b ) const { return static_cast< W >( a | b ); } };
+struct bit_xor { template< class W > W operator()( W a, W b ) const { return static_cast< W >( a ^ b ); } };
+
+template< class Word1, class Word2, class Op >
+inline void bitwise_assign( bit_span< Word1 > const & dst, bit_span< Word2 > const & src, Op op )
+{
+#if span_HAVE( STATIC_ASSERT )
+    static_assert( std11::is_same< typename std11::remove_cv< Word1 >::type, typename std11::remove_cv< Word2 >::type >::value,
+        "bitwise_and(), bitwise_or(), bitwise_xor(): bit spans must have the same word type" );
+#endif
+    span_EXPECTS( dst.size() == src.size() );
+
+    size_t const word_bits = bits_per_word< Word1 >();
+
+    for ( size_t pos = 0; pos < dst.size(); pos += word_bits )
+    {
+        size_t const count = dst.size() - pos < word_bits ? dst.size() - pos : word_bits;
+
+        dst.store( pos, count, op( dst.load( pos, count ), src.load( pos, count ) ) );
+    }
+}
+
+}  // namespace detail
+
+// bitwise_and(), bitwise_or(), bitwise_xor(): dst = dst op src, for bit spans of equal size:
+
+template< class Word1, class Word2 >
+inline void bitwise_and( bit_span< Word1 > const & dst, bit_span< Word2 > const & src )
+{
+    detail::bitwise_assign( dst, src, detail::bit_and() );
+}
+
+template< class Word1, class Word2 >
+inline void bitwise_or( bit_span< Word1 > const & dst, bit_span< Word2 > const & src )
+{
+    detail::bitwise_assign( dst, src, detail::bit_or() );
+}
+
+template< class Word1, class Word2 >
+inline void bitwise_xor( bit_span< Word1 > const & dst, bit_span< Word2 > const & src )
+{
+    detail::bitwise_assign( dst, src, detail::bit_xor() );
+}
+
+#endif // span_FEATURE( BIT_SPAN )
+
+// ring_view [span-lite extension]: a view on count elements of a circular buffer,
+// starting at a position and wrapping around at the end of the buffer:
+
+#if span_FEATURE( RING_VIEW )
+
+// Note: the iterator keeps the physical start and a logical index; it wraps
+// via a comparison, as the index never exceeds the capacity of the buffer.
+
+template< class T >
+class ring_iterator
+{
+public:
+    typedef std::random_access_iterator_tag iterator_category;
+    typedef typename std11::remove_cv< T >::type value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef T * pointer;
+    typedef T & reference;
+
+    span_constexpr ring_iterator() span_noexcept
+        : data_( span_nullptr )
+        , capacity_( 0 )
+        , first_( 0 )
+        , index_( 0 )
+    {}
+
+    span_constexpr ring_iterator( pointer ptr, size_t capacity, size_t first, difference_type index ) span_noexcept
+        : data_( ptr )
+        , capacity_( capacity )
+        , first_( first )
+        , index_( index )
+    {}
+
+    template< class U
+        span_REQUIRES_T((
+            std::is_convertible<U(*)[], T(*)[]>::value
+        ))
+    >
+    span_constexpr ring_iterator( ring_iterator<U> const & other ) span_noexcept
+        : data_( other.data_ )
+        , capacity_( other.capacity_ )
+        , first_( other.first_ )
+        , index_( other.index_ )
+    {}
+
+    span_constexpr reference operator*() const span_noexcept
+    {
+        return data_[ physical( index_ ) ];
+    }
+
+    span_constexpr pointer operator->() const span_noexcept
+    {
+        return data_ + physical( index_ );
+    }
+
+    span_constexpr reference operator[]( difference_type n ) const span_noexcept
+    {
+        return data_[ physical( index_ + n ) ];
+    }
+
+    span_constexpr14 ring_iterator & operator++() span_noexcept
+    {
+        ++index_;
+        return *this;
+    }
+
+    span_constexpr14 ring_iterator operator++( int ) span_noexcept
+    {
+        ring_iterator result( *this );
+        ++index_;
+        return result;
+    }
+
+    span_constexpr14 ring_iterator & operator--() span_noexcept
+    {
+        --index_;
+        return *this;
+    }
+
+    span_constexpr14 ring_iterator operator--( int ) span_noexcept
+    {
+        ring_iterator result( *this );
+        --index_;
+        return result;
+    }
+
+    span_constexpr14 ring_iterator & operator+=( difference_type n ) span_noexcept
+    {
+        index_ += n;
+        return *this;
+    }
+
+    span_constexpr14 ring_iterator & operator-=( difference_type n ) span_noexcept
+    {
+        index_ -= n;
+        return *this;
+    }
+
+    friend span_constexpr ring_iterator operator+( ring_iterator it, difference_type n ) span_noexcept
+    {
+        return ring_iterator( it.data_, it.capacity_, it.first_, it.index_ + n );
+    }
+
+    friend span_constexpr ring_iterator operator+( difference_type n, ring_iterator it ) span_noexcept
+    {
+        return ring_iterator( it.data_, it.capacity_, it.first_, it.index_ + n );
+    }
+
+    friend span_constexpr ring_iterator operator-( ring_iterator it, difference_type n ) span_noexcept
+    {
+        return ring_iterator( it.data_, it.capacity_, it.first_, it.index_ - n );
+    }
+
+    friend span_constexpr difference_type operator-( ring_iterator const & a, ring_iterator const & b ) span_noexcept
+    {
+        return a.index_ - b.index_;
+    }
+
+    friend span_constexpr bool operator==( ring_iterator const & a, ring_iterator const & b ) span_noexcept
+    {
+        return a.index_ == b.index_;
+    }
+
+    friend span_constexpr bool operator!=( ring_iterator const & a, ring_iterator const & b ) span_noexcept
+    {
+        return a.index_ != b.index_;
+    }
+
+    friend span_constexpr bool operator<( ring_iterator const & a, ring_iterator const & b ) span_noexcept
+    {
+        return a.index_ < b.index_;
+    }
+
+    friend span_constexpr bool operator<=( ring_iterator const & a, ring_iterator const & b ) span_noexcept
+    {
+        return a.index_ <= b.index_;
+    }
+
+    friend span_constexpr bool operator>( ring_iterator const & a, ring_iterator const & b ) span_noexcept
+    {
+        return a.index_ > b.index_;
+    }
+
+    friend span_constexpr bool operator>=( ring_iterator const & a, ring_iterator const & b ) span_noexcept
+    {
+        return a.index_ >= b.index_;
+    }
+
+private:
+    template< class U > friend class ring_iterator;
+
+    span_constexpr size_t physical( difference_type index ) const span_noexcept
+    {
+        return first_ + static_cast< size_t >( index ) < capacity_
+            ? first_ + static_cast< size_t >( index )
+            : first_ + static_cast< size_t >( index ) - capacity_;
+    }
+
+    pointer         data_;
+    size_t          capacity_;
+    size_t          first_;
+    difference_type index_;
+};
+
+// The at most two contiguous parts of a ring_view, in order:
+
+template< class T >
+struct ring_regions
+{
+    span< T > first;
+    span< T > second;
+
+    span_constexpr size_t size() const span_noexcept
+    {
+        return first.size() + second.size();
+    }
+};
+
+template< class T >
+class ring_view
+{
+public:
+    typedef T element_type;
+    typedef typename std11::remove_cv< T >::type value_type;
+
+    typedef T &       reference;
+    typedef T *       pointer;
+    typedef T const * const_pointer;
+    typedef T const & const_reference;
+
+    typedef size_t    size_type;
+
+    typedef std::ptrdiff_t difference_type;
+
+    typedef ring_iterator< T >                iterator;
+    typedef std::reverse_iterator< iterator > reverse_iterator;
+
+    span_constexpr ring_view() span_noexcept
+        : buffer_()
+        , first_( 0 )
+        , size_( 0 )
+    {}
+
+    // view count elements of buffer from position pos on, pos is taken modulo the capacity:
+
+    span_constexpr_exp ring_view( span< T > buffer, size_type pos, size_type count )
+        : buffer_( buffer )
+        , first_( buffer.empty() ? 0 : pos % buffer.size() )
+        , size_( count )
+    {
+        span_EXPECTS( count <= buffer.size() );
+    }
+
+    template< class OtherElementType
+        span_REQUIRES_T((
+            std::is_convertible<OtherElementType(*)[], element_type(*)[]>::value
+        ))
+    >
+    span_constexpr ring_view( ring_view< OtherElementType > const & other ) span_noexcept
+        : buffer_( other.buffer() )
+        , first_( other.position() )
+        , size_( other.size() )
+    {}
+
+    // subviews:
+
+    span_constexpr_exp ring_view first( size_type count ) const
+    {
+        span_EXPECTS( count <= size() );
+
+        return ring_view( buffer_, first_, count );
+    }
+
+    span_constexpr_exp ring_view last( size_type count ) const
+    {
+        span_EXPECTS( count <= size() );
+
+        return ring_view( buffer_, first_ + ( size() - count ), count );
+    }
+
+    span_constexpr_exp ring_view subspan( size_type offset, size_type count = static_cast<size_type>(dynamic_extent) ) const
+    {
+        span_EXPECTS(
+            ( offset <= size() ) &&
+            ( count == static_cast<size_type>(dynamic_extent) || count <= size() - offset )
+        );
+
+        return ring_view( buffer_, first_ + offset, count == static_cast<size_type>(dynamic_extent) ? size() - offset : count );
+    }
+
+    // the viewed elements as at most two contiguous spans, e.g. for bulk copying:
+
+    span_constexpr14 ring_regions< T > regions() const span_noexcept
+    {
+        return first_ + size() <= capacity()
+            ? make_regions( buffer_.subspan( first_, size() ), span< T >() )
+            : make_regions( buffer_.subspan( first_ ), buffer_.first( first_ + size() - capacity() ) );
+    }
+
+    // observers:
+
+    span_constexpr span< T > buffer() const span_noexcept
+    {
+        return buffer_;
+    }
+
+    span_constexpr size_type capacity() const span_noexcept
+    {
+        return buffer_.size();
+    }
+
+    span_constexpr size_type position() const span_noexcept
+    {
+        return first_;
+    }
+
+    span_constexpr size_type size() const span_noexcept
+    {
+        return size_;
+    }
+
+    span_nodiscard span_constexpr bool empty() const span_noexcept
+    {
+        return size() == 0;
+    }
+
+    // element access:
+
+    span_constexpr_exp reference operator[]( size_type idx ) const
+    {
+        span_EXPECTS( idx < size() );
+
+        return begin()[ static_cast< difference_type >( idx ) ];
+    }
+
+    span_constexpr_exp reference front() const
+    {
+        span_EXPECTS( ! empty() );
+
+        return *begin();
+    }
+
+    span_constexpr_exp reference back() const
+    {
+        span_EXPECTS( ! empty() );
+
+        return begin()[ static_cast< difference_type >( size() - 1 ) ];
+    }
+
+    // iterator support:
+
+    span_constexpr iterator begin() const span_noexcept
+    {
+        return iterator( buffer_.data(), capacity(), first_, 0 );
+    }
+
+    span_constexpr iterator end() const span_noexcept
+    {
+        return iterator( buffer_.data(), capacity(), first_, static_cast< difference_type >( size() ) );
+    }
+
+    span_constexpr reverse_iterator rbegin() const span_noexcept
+    {
+        return reverse_iterator( end() );
+    }
+
+    span_constexpr reverse_iterator rend() const span_noexcept
+    {
+        return reverse_iterator( begin() );
+    }
+
+private:
+    static span_constexpr14 ring_regions< T > make_regions( span< T > first, span< T > second ) span_noexcept
+    {
+        ring_regions< T > result = { first, second };
+        return result;
+    }
+
+    span< T >  buffer_;
+    size_type  first_;
+    size_type  size_;
+};
+
+// ring_readable(), ring_writable(): the elements a consumer may read and a producer may write,
+// for a single-producer, single-consumer buffer with free-running read and write counts.
+// The counts are taken modulo the capacity; that stays consistent when a count wraps
+// around past SIZE_MAX only if the capacity is a power of two, which is required:
+
+template< class T, extent_t Extent >
+inline span_constexpr_exp ring_view< T >
+ring_readable( span< T, Extent > buffer, size_t read_count, size_t write_count )
+{
+    span_EXPECTS( buffer.size() > 0 && ( buffer.size() & ( buffer.size() - 1 ) ) == 0 );
+    span_EXPECTS( write_count - read_count <= buffer.size() );
+
+    return ring_view< T >( buffer, read_count, write_count - read_count );
+}
+
+template< class T, extent_t Extent >
+inline span_constexpr_exp ring_view< T >
+ring_writable( span< T, Extent > buffer, size_t read_count, size_t write_count )
+{
+    span_EXPECTS( buffer.size() > 0 && ( buffer.size() & ( buffer.size() - 1 ) ) == 0 );
+    span_EXPECTS( write_count - read_count <= buffer.size() );
+
+    return ring_view< T >( buffer, write_count, buffer.size() - ( write_count - read_count ) );
+}
+
+#endif // span_FEATURE( RING_VIEW )
+
+// span_list [span-lite extension]: a sequence of byte spans for scatter/gather I/O:
+
+#if span_FEATURE( SPAN_LIST )
+
+namespace detail {
+
+#if span_HAVE( POSIX )
+typedef ::iovec iovec_type;
+#else
+struct iovec_type
+{
+    void * iov_base;
+    size_t iov_len;
+};
+#endif
+
+}  // namespace detail
+
+// Position of an element as the index of a piece and the offset within that piece:
+
+struct span_list_position
+{
+    size_t piece;
+    size_t offset;
+};
+
+// Pieces are stored as iovec, so that iovecs() can be passed to writev(),
+// readv() and sendmsg() as is. The first N pieces are stored in place.
+
+template< class T, size_t N = 8 >
+class span_list
+{
+#if span_HAVE( STATIC_ASSERT )
+    static_assert( sizeof( T ) == 1, "span_list<>: T must be a byte type, e.g. std::byte const" );
+    static_assert( N > 0, "span_list<>: N must be positive" );
+#endif
+
+public:
+    typedef T element_type;
+    typedef span< T > piece_type;
+    typedef detail::iovec_type iovec_type;
+
+    typedef size_t size_type;
+
+    span_list() span_noexcept
+        : first_( 0 )
+        , count_( 0 )
+        , total_( 0 )
+    {}
+
+    // append a piece; an empty piece is not stored:
+
+    template< extent_t Extent >
+    void push_back( span< T, Extent > piece )
+    {
+        if ( piece.empty() )
+            return;
+
+        // POSIX does not specify the member order of iovec:
+
+        iovec_type iov;
+        iov.iov_base = const_cast< void * >( static_cast< void const volatile * >( piece.data() ) );
+        iov.iov_len  = piece.size();
+
+        // reclaim the pieces consumed at the front; on the heap only once they
+        // are at least as many as the remaining pieces, so that appending
+        // takes amortized constant time:
+
+        if ( first_ != 0 && ( heap_.empty() || first_ >= size() ) )
+        {
+            compact();
+        }
+
+        if ( ! heap_.empty() )
+        {
+            heap_.push_back( iov );
+        }
+        else if ( count_ < N )
+        {
+            inline_[ count_ ] = iov;
+        }
+        else
+        {
+            heap_.reserve( 2 * N );
+            heap_.assign( inline_, inline_ + count_ );
+            heap_.push_back( iov );
+        }
+        ++count_;
+        total_ += piece.size();
+    }
+
+    void clear() span_noexcept
+    {
+        heap_.clear();
+        first_ = count_ = total_ = 0;
+    }
+
+    // observers:
+
+    // number of pieces:
+
+    size_type size() const span_noexcept
+    {
+        return count_ - first_;
+    }
+
+    span_nodiscard bool empty() const span_noexcept
+    {
+        return size() == 0;
+    }
+
+    // total number of elements of all pieces:
+
+    size_type total_size() const span_noexcept
+    {
+        return total_;
+    }
+
+    // element access:
+
+    piece_type operator[]( size_type idx ) const
+    {
+        span_EXPECTS( idx < size() );
+
+        return to_span( pieces()[ idx ] );
+    }
+
+    piece_type front() const
+    {
+        span_EXPECTS( ! empty() );
+
+        return to_span( pieces()[ 0 ] );
+    }
+
+    // the piece and offset within the piece of element offset, {size(), 0} for total_size():
+
+    span_list_position seek( size_type offset ) const
+    {
+        span_EXPECTS( offset <= total_size() );
+
+        span_list_position result = { 0, offset };
+
+        for ( ; result.piece < size() && result.offset >= pieces()[ result.piece ].iov_len; ++result.piece )
+        {
+            result.offset -= pieces()[ result.piece ].iov_len;
+        }
+        return result;
+    }
+
+    // remove count elements from the front, e.g. after a partial write:
+
+    void consume( size_type count )
+    {
+        span_EXPECTS( count <= total_size() );
+
+        span_list_position const pos = seek( count );
+
+        first_ += pos.piece;
+        total_ -= count;
+
+        if ( pos.offset != 0 )
+        {
+            iovec_type & iov = storage()[ first_ ];
+
+            iov.iov_base = static_cast< unsigned char * >( iov.iov_base ) + pos.offset;
+            iov.iov_len -= pos.offset;
+        }
+
+        if ( first_ == count_ )
+        {
+            clear();
+        }
+    }
+
+    // the pieces as iovec for writev(), readv() and sendmsg():
+
+    span< iovec_type const > iovecs() const span_noexcept
+    {
+        return span< iovec_type const >( detail::unchecked, pieces(), size() );
+    }
+
+private:
+    static piece_type to_span( iovec_type const & iov ) span_noexcept
+    {
+        return piece_type( detail::unchecked, static_cast< T * >( iov.iov_base ), iov.iov_len );
+    }
+
+    iovec_type * storage() span_noexcept
+    {
+        return heap_.empty() ? inline_ : &heap_[0];
+    }
+
+    // move the remaining pieces to the front of the storage:
+
+    void compact() span_noexcept
+    {
+        iovec_type * const base = storage();
+        size_type const n = size();
+
+        for ( size_type i = 0; i != n; ++i )
+        {
+            base[ i ] = base[ first_ + i ];
+        }
+
+        if ( ! heap_.empty() )
+        {
+            heap_.erase( heap_.begin() + static_cast< std::ptrdiff_t >( n ), heap_.end() );
+        }
+        first_ = 0;
+        count_ = n;
+    }
+
+    iovec_type const * storage() const span_noexcept
+    {
+        return heap_.empty() ? inline_ : &heap_[0];
+    }
+
+    iovec_type const * pieces() const span_noexcept
+    {
+        return storage() + first_;
+    }
+
+    iovec_type inline_[ N ];
+    std::vector< iovec_type > heap_;
+    size_type first_;
+    size_type count_;
+    size_type total_;
+};
+
+#endif // span_FEATURE( SPAN_LIST )
+
+// mapped_file [span-lite extension]: a memory-mapped file viewed as a span of bytes (POSIX):
+
+#if span_HAVE( MAPPED_FILE )
+
+// Like std::fstream, a mapped_file that fails to open is not open; open()
+// reports failure via its result and errno. The file is mapped shared, so
+// writes through writable_bytes() reach the file.
+
+class mapped_file
+{
+public:
+#if span_HAVE( BYTE ) || span_HAVE( NONSTD_BYTE )
+    typedef std17::byte byte_type;
+#else
+    typedef unsigned char byte_type;
+#endif
+    typedef size_t size_type;
+
+    enum mode_type
+    {
+        read_only,
+        read_write
+    };
+
+    enum advice_type
+    {
+        normal,
+        sequential,
+        random,
+        willneed,
+        dontneed,
+        hugepage
+    };
+
+    mapped_file() span_noexcept
+        : data_( span_nullptr )
+        , size_( 0 )
+        , mode_( read_only )
+        , is_open_( false )
+    {}
+
+    explicit mapped_file( char const * path, mode_type mode = read_only )
+        : data_( span_nullptr )
+        , size_( 0 )
+        , mode_( read_only )
+        , is_open_( false )
+    {
+        open( path, mode );
+    }
+
+#if span_CPP11_OR_GREATER
+    mapped_file( mapped_file && other ) noexcept
+        : data_( span_nullptr )
+        , size_( 0 )
+        , mode_( read_only )
+        , is_open_( false )
+    {
+        swap( other );
+    }
+
+    mapped_file & operator=( mapped_file && other ) noexcept
+    {
+        close();
+        swap( other );
+        return *this;
+    }
+#endif
+
+    ~mapped_file()
+    {
+        close();
+    }
+
+    // map the entire file at path; returns false and leaves errno set on failure:
+
+    bool open( char const * path, mode_type mode = read_only )
+    {
+        close();
+
+        int flags = mode == read_write ? O_RDWR : O_RDONLY;
+#ifdef O_CLOEXEC
+        flags |= O_CLOEXEC;
+#endif
+        int const fd = ::open( path, flags );
+
+        if ( fd < 0 )
+            return false;
+
+        struct stat st;
+
+        if ( ::fstat( fd, &st ) != 0 )
+            return close_fd( fd, false );
+
+        size_type const size = static_cast< size_type >( st.st_size );
+
+        // a file too large to map, e.g. with a 64-bit off_t on a 32-bit target:
+
+        if ( static_cast< off_t >( size ) != st.st_size )
+        {
+            errno = EFBIG;
+            return close_fd( fd, false );
+        }
+
+        void * data = span_nullptr;
+
+        // mmap() rejects a length of zero; an empty file is open with an empty view:
+
+        if ( size > 0 )
+        {
+            data = ::mmap( span_nullptr, size, mode == read_write ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0 );
+
+            if ( data == MAP_FAILED )
+                return close_fd( fd, false );
+        }
+
+        data_    = static_cast< byte_type * >( data );
+        size_    = size;
+        mode_    = mode;
+        is_open_ = true;
+
+        // the mapping remains valid after closing the file descriptor:
+
+        return close_fd( fd, true );
+    }
+
+    void close() span_noexcept
+    {
+        if ( data_ != span_nullptr )
+        {
+            ::munmap( data_, size_ );
+        }
+
+        data_    = span_nullptr;
+        size_    = 0;
+        mode_    = read_only;
+        is_open_ = false;
+    }
+
+    // give the system a hint on how the mapping will be accessed;
+    // returns false and leaves errno set on failure, e.g. when the hint is not supported:
+
+    bool advise( advice_type advice ) const
+    {
+        return advise( advice, 0, size_ );
+    }
+
+    bool advise( advice_type advice, size_type offset, size_type count ) const
+    {
+        span_EXPECTS( offset <= size_ && count <= size_ - offset );
+
+        int native = 0;
+
+        if ( ! to_native( advice, native ) )
+            return false;
+
+        if ( count == 0 )
+            return true;
+
+        // madvise() requires a page-aligned address:
+
+        size_type const page  = static_cast< size_type >( ::sysconf( _SC_PAGESIZE ) );
+        size_type const first = offset - offset % page;
+
+        return 0 == ::madvise( static_cast< void * >( data_ + first ), count + ( offset - first ), native );
+    }
+
+    // write changes to the file before returning:
+
+    bool flush() const span_noexcept
+    {
+        return size_ == 0 || 0 == ::msync( data_, size_, MS_SYNC );
+    }
+
+    void swap( mapped_file & other ) span_noexcept
+    {
+        using std::swap;
+        swap( data_   , other.data_    );
+        swap( size_   , other.size_    );
+        swap( mode_   , other.mode_    );
+        swap( is_open_, other.is_open_ );
+    }
+
+    // observers:
+
+    bool is_open() const span_noexcept
+    {
+        return is_open_;
+    }
+
+    mode_type mode() const span_noexcept
+    {
+        return mode_;
+    }
+
+    size_type size() const span_noexcept
+    {
+        return size_;
+    }
+
+    span_nodiscard bool empty() const span_noexcept
+    {
+        return size_ == 0;
+    }
+
+    // element access:
+
+    span< byte_type const > bytes() const span_noexcept
+    {
+        return span< byte_type const >( detail::unchecked, data_, size_ );
+    }
+
+    span< byte_type > writable_bytes()
+    {
+        span_EXPECTS( mode_ == read_write );
+
+        return span< byte_type >( detail::unchecked, data_, size_ );
+    }
+
+    // the contents as elements of type U; the size must be a multiple of sizeof( U ):
+
+    template< class U >
+    span< U const > as_span() const
+    {
+        return span_lite::as_span< U >( bytes() );
+    }
+
+    template< class U >
+    span< U > as_writable_span()
+    {
+        return span_lite::as_writable_span< U >( writable_bytes() );
+    }
+
+span_is_delete_access:
+    mapped_file( mapped_file const & ) span_is_delete;
+    mapped_file & operator=( mapped_file const & ) span_is_delete;
+
+private:
+    // close fd, preserving errno:
+
+    static bool close_fd( int fd, bool result ) span_noexcept
+    {
+        int const error = errno;
+        ::close( fd );
+        errno = error;
+        return result;
+    }
+
+    static bool to_native( advice_type advice, int & native ) span_noexcept
+    {
+        switch ( advice )
+        {
+            case normal:     native = MADV_NORMAL;     return true;
+            case sequential: native = MADV_SEQUENTIAL; return true;
+            case random:     native = MADV_RANDOM;     return true;
+            case willneed:   native = MADV_WILLNEED;   return true;
+            case dontneed:   native = MADV_DONTNEED;   return true;
+#ifdef MADV_HUGEPAGE
+            case hugepage:   native = MADV_HUGEPAGE;   return true;
+#else
+            case hugepage:   break;
+#endif
+        }
+        errno = EINVAL;
+        return false;
+    }
+
+    byte_type * data_;
+    size_type size_;
+    mode_type mode_;
+    bool is_open_;
+};
+
+#endif // span_HAVE( MAPPED_FILE )
+
+// Fixed-size integers of a given byte order, for byte_reader, byte_writer and unaligned_span:
+
+#if span_FEATURE( BYTE_READER ) || span_FEATURE( BYTE_WRITER ) || span_FEATURE( UNALIGNED_SPAN )
+
+namespace detail {
+
+#if span_CPP11_120
+typedef std::uint16_t uint16_type;
+typedef std::uint32_t uint32_type;
+typedef std::uint64_t uint64_type;
+typedef std::uint64_t varint_type;
+#else
+typedef unsigned short uint16_type;
+typedef unsigned int   uint32_type;
+typedef unsigned long  varint_type;
+#endif
+
+// Composing a value from bytes via shifts and decomposing it likewise is
+// independent of the byte order of the platform; compilers turn each into
+// a single load or store and a swap. The unused second parameter of the
+// loads selects the width.
+
+inline span_constexpr uint16_type load_le( unsigned char const * p, uint16_type ) span_noexcept
+{
+    return static_cast< uint16_type >( p[0] | p[1] << 8 );
+}
+
+inline span_constexpr uint16_type load_be( unsigned char const * p, uint16_type ) span_noexcept
+{
+    return static_cast< uint16_type >( p[0] << 8 | p[1] );
+}
+
+inline span_constexpr uint32_type load_le( unsigned char const * p, uint32_type ) span_noexcept
+{
+    return uint32_type( p[0] ) | uint32_type( p[1] ) << 8 | uint32_type( p[2] ) << 16 | uint32_type( p[3] ) << 24;
+}
+
+inline span_constexpr uint32_type load_be( unsigned char const * p, uint32_type ) span_noexcept
+{
+    return uint32_type( p[0] ) << 24 | uint32_type( p[1] ) << 16 | uint32_type( p[2] ) << 8 | uint32_type( p[3] );
+}
+
+#if span_CPP11_120
+inline span_constexpr uint64_type load_le( unsigned char const * p, uint64_type ) span_noexcept
+{
+    return uint64_type( load_le( p, uint32_type() ) ) | uint64_type( load_le( p + 4, uint32_type() ) ) << 32;
+}
+
+inline span_constexpr uint64_type load_be( unsigned char const * p, uint64_type ) span_noexcept
+{
+    return uint64_type( load_be( p, uint32_type() ) ) << 32 | uint64_type( load_be( p + 4, uint32_type() ) );
+}
+#endif
+
+inline span_constexpr14 void store_le( unsigned char * p, uint16_type v ) span_noexcept
+{
+    p[0] = static_cast< unsigned char >( v      );
+    p[1] = static_cast< unsigned char >( v >> 8 );
+}
+
+inline span_constexpr14 void store_be( unsigned char * p, uint16_type v ) span_noexcept
+{
+    p[0] = static_cast< unsigned char >( v >> 8 );
+    p[1] = static_cast< unsigned char >( v      );
+}
+
+inline span_constexpr14 void store_le( unsigned char * p, uint32_type v ) span_noexcept
+{
+    p[0] = static_cast< unsigned char >( v       );
+    p[1] = static_cast< unsigned char >( v >>  8 );
+    p[2] = static_cast< unsigned char >( v >> 16 );
+    p[3] = static_cast< unsigned char >( v >> 24 );
+}
+
+inline span_constexpr14 void store_be( unsigned char * p, uint32_type v ) span_noexcept
+{
+    p[0] = static_cast< unsigned char >( v >> 24 );
+    p[1] = static_cast< unsigned char >( v >> 16 );
+    p[2] = static_cast< unsigned char >( v >>  8 );
+    p[3] = static_cast< unsigned char >( v       );
+}
+
+#if span_CPP11_120
+inline span_constexpr14 void store_le( unsigned char * p, uint64_type v ) span_noexcept
+{
+    store_le( p    , static_cast< uint32_type >( v       ) );
+    store_le( p + 4, static_cast< uint32_type >( v >> 32 ) );
+}
+
+inline span_constexpr14 void store_be( unsigned char * p, uint64_type v ) span_noexcept
+{
+    store_be( p    , static_cast< uint32_type >( v >> 32 ) );
+    store_be( p + 4, static_cast< uint32_type >( v       ) );
+}
+#endif
+
+}  // namespace detail
+
+template< class T, bool BigEndian >
+struct endian_field
+{
+    typedef T value_type;
+
+    static span_constexpr value_type load( unsigned char const * ptr ) span_noexcept
+    {
+        return BigEndian ? detail::load_be( ptr, value_type() ) : detail::load_le( ptr, value_type() );
+    }
+
+    static span_constexpr14 void store( unsigned char * ptr, value_type value ) span_noexcept
+    {
+        BigEndian ? detail::store_be( ptr, value ) : detail::store_le( ptr, value );
+    }
+};
+
+typedef endian_field< detail::uint16_type, false > uint16_le;
+typedef endian_field< detail::uint16_type, true  > uint16_be;
+typedef endian_field< detail::uint32_type, false > uint32_le;
+typedef endian_field< detail::uint32_type, true  > uint32_be;
+#if span_CPP11_120
+typedef endian_field< detail::uint64_type, false > uint64_le;
+typedef endian_field< detail::uint64_type, true  > uint64_be;
+#endif
+
+#endif // span_FEATURE( BYTE_READER ) || span_FEATURE( BYTE_WRITER ) || span_FEATURE( UNALIGNED_SPAN )
+
+// basic_byte_reader [span-lite extension]: a cursor that decodes values from a span of bytes:
+
+#if span_FEATURE( BYTE_READER )
+
+// With checked_policy, each read checks the bounds once for the value, not
+// per byte (fail fast). With unchecked_policy, reads are not checked; to
+// decode untrusted input, check the size of a record once via can_read()
+// before reading its fields.
+
+template< class Policy = checked_policy >
+class basic_byte_reader
+{
+public:
+#if span_HAVE( BYTE ) || span_HAVE( NONSTD_BYTE )
+    typedef std17::byte byte_type;
+#else
+    typedef unsigned char byte_type;
+#endif
+    typedef Policy policy_type;
+    typedef size_t size_type;
+    typedef detail::varint_type varint_type;
+
+    span_constexpr basic_byte_reader() span_noexcept
+        : begin_( span_nullptr )
+        , pos_( span_nullptr )
+        , end_( span_nullptr )
+    {}
+
+    // from a span of a byte type, e.g. std::byte const, unsigned char const, char const:
+
+    template< class B, extent_t Extent >
+    explicit basic_byte_reader( span< B, Extent > bytes ) span_noexcept
+        : begin_( reinterpret_cast< unsigned char const * >( bytes.data() ) )  // NOLINT
+        , pos_( begin_ )
+        , end_( begin_ + bytes.size() )
+    {
+#if span_HAVE( STATIC_ASSERT )
+        static_assert( sizeof( B ) == 1, "basic_byte_reader: B must be a byte type, e.g. std::byte const" );
+#endif
+    }
+
+    // observers:
+
+    // number of bytes read:
+
+    span_constexpr size_type position() const span_noexcept
+    {
+        return static_cast< size_type >( pos_ - begin_ );
+    }
+
+    // number of bytes left:
+
+    span_constexpr size_type size() const span_noexcept
+    {
+        return static_cast< size_type >( end_ - pos_ );
+    }
+
+    span_nodiscard span_constexpr bool empty() const span_noexcept
+    {
+        return pos_ == end_;
+    }
+
+    span_constexpr bool can_read( size_type count ) const span_noexcept
+    {
+        return count <= size();
+    }
+
+    span< byte_type const > remaining() const span_noexcept
+    {
+        return span< byte_type const >( detail::unchecked, reinterpret_cast< byte_type const * >( pos_ ), size() );  // NOLINT
+    }
+
+    // reading, e.g. read< uint32_le >():
+
+    template< class Field >
+    span_constexpr14 typename Field::value_type peek() const
+    {
+        span_EXPECTS( !Policy::checked || can_read( sizeof( typename Field::value_type ) ) );
+
+        return Field::load( pos_ );
+    }
+
+    template< class Field >
+    span_constexpr14 typename Field::value_type read()
+    {
+        span_EXPECTS( !Policy::checked || can_read( sizeof( typename Field::value_type ) ) );
+
+        typename Field::value_type const value = Field::load( pos_ );
+        pos_ += sizeof( typename Field::value_type );
+        return value;
+    }
+
+    // the next count bytes, without copying:
+
+    span< byte_type const > read_span( size_type count )
+    {
+        span_EXPECTS( !Policy::checked || can_read( count ) );
+
+        pos_ += count;
+        return span< byte_type const >( detail::unchecked, reinterpret_cast< byte_type const * >( pos_ - count ), count );  // NOLINT
+    }
+
+    span_constexpr14 void skip( size_type count )
+    {
+        span_EXPECTS( !Policy::checked || can_read( count ) );
+
+        pos_ += count;
+    }
+
+    // an unsigned LEB128 varint; returns false and reads nothing if the
+    // varint is truncated or does not fit varint_type:
+
+    span_constexpr14 bool read_varint( varint_type & value ) span_noexcept
+    {
+        size_type const digits = sizeof( varint_type ) * CHAR_BIT;
+        size_type const limit  = ( digits + 6 ) / 7;
+
+        varint_type result = 0;
+
+        for ( size_type i = 0; i < limit && i < size(); ++i )
+        {
+            unsigned char const octet = pos_[i];
+
+            if ( i == limit - 1 && ( octet >> ( digits - 7 * i ) ) != 0 )
+                return false;
+
+            result |= static_cast< varint_type >( octet & 0x7f ) << ( 7 * i );
+
+            if ( ( octet & 0x80 ) == 0 )
+            {
+                value = result;
+                pos_ += i + 1;
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    unsigned char const * begin_;
+    unsigned char const * pos_;
+    unsigned char const * end_;
+};
+
+typedef basic_byte_reader< checked_policy   > byte_reader;
+typedef basic_byte_reader< unchecked_policy > unchecked_byte_reader;
+
+#endif // span_FEATURE( BYTE_READER )
+
+// basic_byte_writer [span-lite extension]: a cursor that encodes values into a span of bytes:
+
+#if span_FEATURE( BYTE_WRITER )
+
+// With checked_policy, each write checks the bounds once for the value
+// (fail fast). With unchecked_policy, writes are not checked; check the
+// size of a batch of writes once via can_write() instead.
+
+template< class Policy = checked_policy >
+class basic_byte_writer
+{
+public:
+#if span_HAVE( BYTE ) || span_HAVE( NONSTD_BYTE )
+    typedef std17::byte byte_type;
+#else
+    typedef unsigned char byte_type;
+#endif
+    typedef Policy policy_type;
+    typedef size_t size_type;
+    typedef detail::varint_type varint_type;
+
+    span_constexpr basic_byte_writer() span_noexcept
+        : begin_( span_nullptr )
+        , pos_( span_nullptr )
+        , end_( span_nullptr )
+    {}
+
+    // into a span of a byte type, e.g. std::byte, unsigned char, char:
+
+    template< class B, extent_t Extent >
+    explicit basic_byte_writer( span< B, Extent > bytes ) span_noexcept
+        : begin_( reinterpret_cast< unsigned char * >( bytes.data() ) )  // NOLINT
+        , pos_( begin_ )
+        , end_( begin_ + bytes.size() )
+    {
+#if span_HAVE( STATIC_ASSERT )
+        static_assert( sizeof( B ) == 1, "basic_byte_writer: B must be a byte type, e.g. std::byte" );
+#endif
+    }
+
+    // observers:
+
+    // number of bytes written:
+
+    span_constexpr size_type position() const span_noexcept
+    {
+        return static_cast< size_type >( pos_ - begin_ );
+    }
+
+    // number of bytes left:
+
+    span_constexpr size_type size() const span_noexcept
+    {
+        return static_cast< size_type >( end_ - pos_ );
+    }
+
+    span_nodiscard span_constexpr bool empty() const span_noexcept
+    {
+        return pos_ == end_;
+    }
+
+    span_constexpr bool can_write( size_type count ) const span_noexcept
+    {
+        return count <= size();
+    }
+
+    span< byte_type > written() const span_noexcept
+    {
+        return span< byte_type >( detail::unchecked, reinterpret_cast< byte_type * >( begin_ ), position() );  // NOLINT
+    }
+
+    span< byte_type > remaining() const span_noexcept
+    {
+        return span< byte_type >( detail::unchecked, reinterpret_cast< byte_type * >( pos_ ), size() );  // NOLINT
+    }
+
+    // writing, e.g. write< uint32_le >( value ):
+
+    template< class Field >
+    span_constexpr14 void write( typename Field::value_type value )
+    {
+        span_EXPECTS( !Policy::checked || can_write( sizeof( typename Field::value_type ) ) );
+
+        Field::store( pos_, value );
+        pos_ += sizeof( typename Field::value_type );
+    }
+
+    // a copy of bytes, e.g. a span of std::byte const:
+
+    template< class B, extent_t Extent >
+    void write_span( span< B, Extent > bytes )
+    {
+        span_EXPECTS( !Policy::checked || can_write( bytes.size() ) );
+
+        if ( ! bytes.empty() )
+        {
+            std::memcpy( pos_, bytes.data(), bytes.size() );
+        }
+        pos_ += bytes.size();
+    }
+
+    // the next count bytes, to fill in later, e.g. a length prefix:
+
+    span< byte_type > reserve( size_type count )
+    {
+        span_EXPECTS( !Policy::checked || can_write( count ) );
+
+        pos_ += count;
+        return span< byte_type >( detail::unchecked, reinterpret_cast< byte_type * >( pos_ - count ), count );  // NOLINT
+    }
+
+    // an unsigned LEB128 varint of varint_size( value ) bytes:
+
+    span_constexpr14 void write_varint( varint_type value )
+    {
+        span_EXPECTS( !Policy::checked || can_write( varint_size( value ) ) );
+
+        for ( ; value >= 0x80; value >>= 7 )
+        {
+            *pos_++ = static_cast< unsigned char >( value | 0x80 );
+        }
+        *pos_++ = static_cast< unsigned char >( value );
+    }
+
+    static span_constexpr14 size_type varint_size( varint_type value ) span_noexcept
+    {
+        size_type result = 1;
+
+        for ( ; value >= 0x80; value >>= 7 )
+        {
+            ++result;
+        }
+        return result;
+    }
+
+private:
+    unsigned char * begin_;
+    unsigned char * pos_;
+    unsigned char * end_;
+};
+
+typedef basic_byte_writer< checked_policy   > byte_writer;
+typedef basic_byte_writer< unchecked_policy > unchecked_byte_writer;
+
+#endif // span_FEATURE( BYTE_WRITER )
+
+// basic_spanbuf, basic_ispanstream, basic_ospanstream, basic_spanstream [span-lite extension]:
+// streams over caller-provided storage, like C++23 <spanstream>:
+
+#if span_FEATURE( SPANSTREAM )
+
+// The buffer does not grow: writing beyond its end fails, setting badbit
+// on the stream. Member span() yields the characters written in output
+// mode and the entire buffer otherwise.
+
+template< class CharT, class Traits = std::char_traits< CharT > >
+class basic_spanbuf : public std::basic_streambuf< CharT, Traits >
+{
+public:
+    typedef CharT char_type;
+    typedef Traits traits_type;
+    typedef typename Traits::int_type int_type;
+    typedef typename Traits::pos_type pos_type;
+    typedef typename Traits::off_type off_type;
+
+    // member function span() hides class template span:
+
+    typedef span_lite::span< CharT > span_type;
+
+    basic_spanbuf()
+        : mode_( std::ios_base::in | std::ios_base::out )
+    {}
+
+    explicit basic_spanbuf( std::ios_base::openmode which )
+        : mode_( which )
+    {}
+
+    explicit basic_spanbuf( span_type s, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out )
+        : mode_( which )
+    {
+        span( s );
+    }
+
+    span_type span() const span_noexcept
+    {
+        if ( mode_ & std::ios_base::out )
+        {
+            return span_type( detail::unchecked, this->pbase(), static_cast< size_t >( this->pptr() - this->pbase() ) );
+        }
+        return buf_;
+    }
+
+    void span( span_type s ) span_noexcept
+    {
+        buf_ = s;
+
+        if ( mode_ & std::ios_base::in )
+        {
+            this->setg( s.data(), s.data(), s.data() + s.size() );
+        }
+
+        if ( mode_ & std::ios_base::out )
+        {
+            this->setp( s.data(), s.data() + s.size() );
+
+            if ( mode_ & std::ios_base::ate )
+            {
+                advance_put( s.size() );
+            }
+        }
+    }
+
+protected:
+    basic_spanbuf * setbuf( CharT * ptr, std::streamsize count )
+    {
+        span( span_type( ptr, static_cast< size_t >( count ) ) );
+        return this;
+    }
+
+    pos_type seekoff( off_type off, std::ios_base::seekdir way, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out )
+    {
+        pos_type const error = pos_type( off_type( -1 ) );
+
+        bool const in  = ( which & mode_ & std::ios_base::in  ) != 0;
+        bool const out = ( which & mode_ & std::ios_base::out ) != 0;
+
+        if ( ( ! in && ! out ) || ( in && out && way == std::ios_base::cur ) )
+            return error;
+
+        off_type base = 0;
+
+        if ( way == std::ios_base::cur )
+        {
+            base = in ? off_type( this->gptr() - this->eback() ) : off_type( this->pptr() - this->pbase() );
+        }
+        else if ( way == std::ios_base::end )
+        {
+            base = ( mode_ & std::ios_base::out ) && !( mode_ & std::ios_base::in ) ? off_type( this->pptr() - this->pbase() ) : off_type( buf_.size() );
+        }
+
+        off_type const pos = base + off;
+
+        if ( pos < 0 || pos > off_type( buf_.size() ) )
+            return error;
+
+        if ( in )
+        {
+            this->setg( this->eback(), this->eback() + pos, this->egptr() );
+        }
+
+        if ( out )
+        {
+            this->setp( buf_.data(), buf_.data() + buf_.size() );
+            advance_put( static_cast< size_t >( pos ) );
+        }
+        return pos_type( pos );
+    }
+
+    pos_type seekpos( pos_type sp, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out )
+    {
+        return seekoff( off_type( sp ), std::ios_base::beg, which );
+    }
+
+private:
+    // pbump() takes an int:
+
+    void advance_put( size_t count ) span_noexcept
+    {
+        for ( ; count > static_cast< size_t >( INT_MAX ); count -= static_cast< size_t >( INT_MAX ) )
+        {
+            this->pbump( INT_MAX );
+        }
+        this->pbump( static_cast< int >( count ) );
+    }
+
+    std::ios_base::openmode mode_;
+    span_type buf_;
+};
+
+// The streams pass their buffer to the base before the buffer is constructed;
+// the base only stores the pointer, as with std::basic_stringstream:
+
+template< class CharT, class Traits = std::char_traits< CharT > >
+class basic_ispanstream : public std::basic_istream< CharT, Traits >
+{
+public:
+    typedef basic_spanbuf< CharT, Traits > buffer_type;
+    typedef typename buffer_type::span_type span_type;
+    typedef span_lite::span< CharT const > const_span_type;
+
+    explicit basic_ispanstream( span_type s, std::ios_base::openmode which = std::ios_base::in )
+        : std::basic_istream< CharT, Traits >( &sb_ )
+        , sb_( s, which | std::ios_base::in )
+    {}
+
+    // reading does not modify the characters:
+
+    explicit basic_ispanstream( const_span_type s )
+        : std::basic_istream< CharT, Traits >( &sb_ )
+        , sb_( span_type( detail::unchecked, const_cast< CharT * >( s.data() ), s.size() ), std::ios_base::in )
+    {}
+
+    buffer_type * rdbuf() const span_noexcept
+    {
+        return const_cast< buffer_type * >( &sb_ );
+    }
+
+    const_span_type span() const span_noexcept
+    {
+        return sb_.span();
+    }
+
+    void span( span_type s ) span_noexcept
+    {
+        sb_.span( s );
+    }
+
+private:
+    buffer_type sb_;
+};
+
+template< class CharT, class Traits = std::char_traits< CharT > >
+class basic_ospanstream : public std::basic_ostream< CharT, Traits >
+{
+public:
+    typedef basic_spanbuf< CharT, Traits > buffer_type;
+    typedef typename buffer_type::span_type span_type;
+
+    explicit basic_ospanstream( span_type s, std::ios_base::openmode which = std::ios_base::out )
+        : std::basic_ostream< CharT, Traits >( &sb_ )
+        , sb_( s, which | std::ios_base::out )
+    {}
+
+    buffer_type * rdbuf() const span_noexcept
+    {
+        return const_cast< buffer_type * >( &sb_ );
+    }
+
+    span_type span() const span_noexcept
+    {
+        return sb_.span();
+    }
+
+    void span( span_type s ) span_noexcept
+    {
+        sb_.span( s );
+    }
+
+private:
+    buffer_type sb_;
+};
+
+template< class CharT, class Traits = std::char_traits< CharT > >
+class basic_spanstream : public std::basic_iostream< CharT, Traits >
+{
+public:
+    typedef basic_spanbuf< CharT, Traits > buffer_type;
+    typedef typename buffer_type::span_type span_type;
+
+    explicit basic_spanstream( span_type s, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out )
+        : std::basic_iostream< CharT, Traits >( &sb_ )
+        , sb_( s, which )
+    {}
+
+    buffer_type * rdbuf() const span_noexcept
+    {
+        return const_cast< buffer_type * >( &sb_ );
+    }
+
+    span_type span() const span_noexcept
+    {
+        return sb_.span();
+    }
+
+    void span( span_type s ) span_noexcept
+    {
+        sb_.span( s );
+    }
+
+private:
+    buffer_type sb_;
+};
+
+typedef basic_spanbuf    < char    > spanbuf;
+typedef basic_spanbuf    < wchar_t > wspanbuf;
+typedef basic_ispanstream< char    > ispanstream;
+typedef basic_ispanstream< wchar_t > wispanstream;
+typedef basic_ospanstream< char    > ospanstream;
+typedef basic_ospanstream< wchar_t > wospanstream;
+typedef basic_spanstream < char    > spanstream;
+typedef basic_spanstream < wchar_t > wspanstream;
+
+#endif // span_FEATURE( SPANSTREAM )
+
+// monotonic_arena [span-lite extension]: bump allocation from a span of bytes:
+
+#if span_FEATURE( MONOTONIC_ARENA )
+
+// Memory is released all at once via rewind() or reset(), not per allocation.
+// If the storage is exhausted, an allocation is served by the upstream arena,
+// if any; rewinding an arena does not release memory of its upstream arena.
+
+class monotonic_arena
+{
+public:
+    typedef size_t size_type;
+    typedef size_t mark_type;
+
+    span_constexpr monotonic_arena() span_noexcept
+        : begin_( span_nullptr )
+        , size_( 0 )
+        , used_( 0 )
+        , upstream_( span_nullptr )
+    {}
+
+    // from a span of a byte type, e.g. std::byte, unsigned char, char:
+
+    template< class B, extent_t Extent >
+    explicit monotonic_arena( span< B, Extent > storage, monotonic_arena * upstream = span_nullptr ) span_noexcept
+        : begin_( reinterpret_cast< unsigned char * >( storage.data() ) )  // NOLINT
+        , size_( storage.size() )
+        , used_( 0 )
+        , upstream_( upstream )
+    {
+#if span_HAVE( STATIC_ASSERT )
+        static_assert( sizeof( B ) == 1, "monotonic_arena: B must be a byte type, e.g. std::byte" );
+#endif
+    }
+
+    // size bytes aligned to alignment, a power of two; null if out of memory:
+
+    void * allocate_bytes( size_type size, size_type alignment ) span_noexcept
+    {
+        span_EXPECTS( alignment > 0 && ( alignment & ( alignment - 1 ) ) == 0 );
+
+        size_type const pad = static_cast< size_type >( detail::uintptr_type( 0 ) - reinterpret_cast< detail::uintptr_type >( begin_ + used_ ) ) & ( alignment - 1 );
+
+        if ( span_LIKELY( pad <= available() && size <= available() - pad ) )
+        {
+            void * const result = begin_ + used_ + pad;
+            used_ += pad + size;
+            return result;
+        }
+        return upstream_ != span_nullptr ? upstream_->allocate_bytes( size, alignment ) : span_nullptr;
+    }
+
+    // storage for count objects of type T; the objects are not constructed, so
+    // T is an implicit-lifetime type, such as a scalar or a trivial struct:
+
+    template< class T >
+    span< T > try_allocate( size_type count ) span_noexcept
+    {
+        if ( count > static_cast< size_type >( -1 ) / sizeof( T ) )
+            return span< T >();
+
+        void * const ptr = allocate_bytes( count * sizeof( T ), detail::alignment_of< T >::value );
+
+        return ptr != span_nullptr ? span< T >( detail::unchecked, static_cast< T * >( ptr ), count ) : span< T >();
+    }
+
+    // as try_allocate(), running out of memory is a contract violation:
+
+    template< class T >
+    span< T > allocate( size_type count )
+    {
+        span< T > const result = try_allocate< T >( count );
+
+        span_EXPECTS( result.data() != span_nullptr || count == 0 );
+
+        return result;
+    }
+
+    // checkpoints:
+
+    mark_type mark() const span_noexcept
+    {
+        return used_;
+    }
+
+    // release the memory allocated from this arena since mark m:
+
+    void rewind( mark_type m )
+    {
+        span_EXPECTS( m <= used_ );
+
+        used_ = m;
+    }
+
+    void reset() span_noexcept
+    {
+        used_ = 0;
+    }
+
+    // observers:
+
+    size_type capacity() const span_noexcept
+    {
+        return size_;
+    }
+
+    size_type used() const span_noexcept
+    {
+        return used_;
+    }
+
+    size_type available() const span_noexcept
+    {
+        return size_ - used_;
+    }
+
+    monotonic_arena * upstream() const span_noexcept
+    {
+        return upstream_;
+    }
+
+span_is_delete_access:
+    monotonic_arena( monotonic_arena const & ) span_is_delete;
+    monotonic_arena & operator=( monotonic_arena const & ) span_is_delete;
+
+private:
+    unsigned char * begin_;
+    size_type size_;
+    size_type used_;
+    monotonic_arena * upstream_;
+};
+
+#if span_HAVE( MEMORY_RESOURCE )
+
+// std::pmr::memory_resource adaptor; deallocation is a no-op, as with
+// std::pmr::monotonic_buffer_resource:
+
+class monotonic_arena_resource : public std::pmr::memory_resource
+{
+public:
+    explicit monotonic_arena_resource( monotonic_arena & arena ) noexcept
+        : arena_( &arena )
+    {}
+
+    monotonic_arena & arena() const noexcept
+    {
+        return *arena_;
+    }
+
+private:
+    void * do_allocate( size_t bytes, size_t alignment ) override
+    {
+        void * const result = arena_->allocate_bytes( bytes, alignment );
+
+        if ( result == nullptr )
+        {
+#if span_CONFIG( NO_EXCEPTIONS )
+            std::terminate();
+#else
+            throw std::bad_alloc();
+#endif
+        }
+        return result;
+    }
+
+    void do_deallocate( void *, size_t, size_t ) override {}
+
+    bool do_is_equal( std::pmr::memory_resource const & other ) const noexcept override
+    {
+        return this == &other;
+    }
+
+    monotonic_arena * arena_;
+};
+
+#endif // span_HAVE( MEMORY_RESOURCE )
+
+#endif // span_FEATURE( MONOTONIC_ARENA )
+
+// span_vector [span-lite extension]: a vector with the fixed capacity of borrowed storage:
+
+#if span_FEATURE( SPAN_VECTOR )
+
+// Tag to construct a span_vector on uninitialized storage:
+
+struct uninitialized_storage_t { span_constexpr uninitialized_storage_t() span_noexcept {} };
+const  span_constexpr   uninitialized_storage_t uninitialized_storage;
+
+// On a span of objects, the objects are alive; elements are assigned to and
+// remain alive when removed. On uninitialized storage, elements are
+// constructed when added and destroyed when removed or with the span_vector.
+// Exceeding the capacity is a contract violation.
+
+template< class T >
+class span_vector
+{
+public:
+    typedef T element_type;
+    typedef typename std11::remove_cv< T >::type value_type;
+
+    typedef T &       reference;
+    typedef T *       pointer;
+    typedef T const * const_pointer;
+    typedef T const & const_reference;
+
+    typedef size_t    size_type;
+
+    typedef pointer       iterator;
+    typedef const_pointer const_iterator;
+
+    span_constexpr span_vector() span_noexcept
+        : data_( span_nullptr )
+        , size_( 0 )
+        , capacity_( 0 )
+        , constructs_( false )
+    {}
+
+    // the first count objects of storage are elements:
+
+    template< extent_t Extent >
+    explicit span_vector( span< T, Extent > storage, size_type count = 0 )
+        : data_( storage.data() )
+        , size_( count )
+        , capacity_( storage.size() )
+        , constructs_( false )
+    {
+        span_EXPECTS( count <= storage.size() );
+    }
+
+    // uninitialized storage of a byte type, e.g. std::byte, unsigned char, char:
+
+    template< class B, extent_t Extent >
+    span_vector( uninitialized_storage_t, span< B, Extent > bytes ) span_noexcept
+        : data_( span_nullptr )
+        , size_( 0 )
+        , capacity_( 0 )
+        , constructs_( true )
+    {
+#if span_HAVE( STATIC_ASSERT )
+        static_assert( sizeof( B ) == 1, "span_vector: B must be a byte type, e.g. std::byte" );
+#endif
+        unsigned char * const ptr = reinterpret_cast< unsigned char * >( bytes.data() );  // NOLINT
+        size_type const pad = static_cast< size_type >( detail::uintptr_type( 0 ) - reinterpret_cast< detail::uintptr_type >( ptr ) ) & ( detail::alignment_of< T >::value - 1 );
+
+        if ( pad < bytes.size() )
+        {
+            data_     = reinterpret_cast< pointer >( ptr + pad );  // NOLINT
+            capacity_ = ( bytes.size() - pad ) / sizeof( T );
+        }
+    }
+
+    ~span_vector()
+    {
+        clear();
+    }
+
+    // modifiers:
+
+    void push_back( const_reference value )
+    {
+        span_EXPECTS( ! full() );
+
+        if ( constructs_ ) { ::new( static_cast< void * >( data_ + size_ ) ) T( value ); }
+        else               { data_[ size_ ] = value; }
+        ++size_;
+    }
+
+#if span_CPP11_120
+    void push_back( value_type && value )
+    {
+        span_EXPECTS( ! full() );
+
+        if ( constructs_ ) { ::new( static_cast< void * >( data_ + size_ ) ) T( std::move( value ) ); }
+        else               { data_[ size_ ] = std::move( value ); }
+        ++size_;
+    }
+
+    template< class... Args >
+    reference emplace_back( Args &&... args )
+    {
+        span_EXPECTS( ! full() );
+
+        if ( constructs_ ) { ::new( static_cast< void * >( data_ + size_ ) ) T( std::forward< Args >( args )... ); }
+        else               { data_[ size_ ] = T( std::forward< Args >( args )... ); }
+        return data_[ size_++ ];
+    }
+#endif
+
+    void pop_back()
+    {
+        span_EXPECTS( ! empty() );
+
+        shrink( size_ - 1 );
+    }
+
+    iterator erase( const_iterator pos )
+    {
+        span_EXPECTS( begin() <= pos && pos < end() );
+
+        return erase( pos, pos + 1 );
+    }
+
+    iterator erase( const_iterator first, const_iterator last )
+    {
+        span_EXPECTS( begin() <= first && first <= last && last <= end() );
+
+        iterator const dest = begin() + ( first - begin() );
+        iterator const src  = begin() + ( last  - begin() );
+
+#if span_CPP11_OR_GREATER
+        std::move( src, end(), dest );
+#else
+        std::copy( src, end(), dest );
+#endif
+        shrink( size_ - static_cast< size_type >( last - first ) );
+        return dest;
+    }
+
+    void resize( size_type count )
+    {
+        span_EXPECTS( count <= capacity_ );
+
+        for ( ; size_ < count; ++size_ )
+        {
+            if ( constructs_ ) { ::new( static_cast< void * >( data_ + size_ ) ) T(); }
+            else               { data_[ size_ ] = T(); }
+        }
+        shrink( count );
+    }
+
+    void resize( size_type count, const_reference value )
+    {
+        span_EXPECTS( count <= capacity_ );
+
+        for ( ; size_ < count; ++size_ )
+        {
+            if ( constructs_ ) { ::new( static_cast< void * >( data_ + size_ ) ) T( value ); }
+            else               { data_[ size_ ] = value; }
+        }
+        shrink( count );
+    }
+
+    void clear() span_noexcept
+    {
+        shrink( 0 );
+    }
+
+    // observers:
+
+    size_type size() const span_noexcept
+    {
+        return size_;
+    }
+
+    size_type capacity() const span_noexcept
+    {
+        return capacity_;
+    }
+
+    span_nodiscard bool empty() const span_noexcept
+    {
+        return size_ == 0;
+    }
+
+    bool full() const span_noexcept
+    {
+        return size_ == capacity_;
+    }
+
+    // element access:
+
+    reference operator[]( size_type idx ) const
+    {
+        span_EXPECTS( idx < size_ );
+
+        return data_[ idx ];
+    }
+
+    reference front() const
+    {
+        span_EXPECTS( ! empty() );
+
+        return data_[ 0 ];
+    }
+
+    reference back() const
+    {
+        span_EXPECTS( ! empty() );
+
+        return data_[ size_ - 1 ];
+    }
+
+    pointer data() const span_noexcept
+    {
+        return data_;
+    }
+
+    // the elements:
+
+    span< T > as_span() const span_noexcept
+    {
+        return span< T >( detail::unchecked, data_, size_ );
+    }
+
+    // iterator support:
+
+    iterator begin() const span_noexcept
+    {
+        return data_;
+    }
+
+    iterator end() const span_noexcept
+    {
+        return data_ + size_;
+    }
+
+span_is_delete_access:
+    span_vector( span_vector const & ) span_is_delete;
+    span_vector & operator=( span_vector const & ) span_is_delete;
+
+private:
+    // remove the elements from count on:
+
+    void shrink( size_type count ) span_noexcept
+    {
+        if ( constructs_ )
+        {
+            for ( size_type i = count; i < size_; ++i )
+            {
+                data_[ i ].~T();
+            }
+        }
+        if ( count < size_ )
+        {
+            size_ = count;
+        }
+    }
+
+    pointer data_;
+    size_type size_;
+    size_type capacity_;
+    bool constructs_;
+};
+
+#endif // span_FEATURE( SPAN_VECTOR )
+
+// unaligned_span [span-lite extension]: a view of a span of bytes as a sequence of
+// values of type T that may be stored at any address, e.g. in a packed record:
+
+#if span_FEATURE( UNALIGNED_SPAN )
+
+// A T in the byte order of the platform. Copying via memcpy() is how to
+// access a misaligned value without undefined behaviour; compilers turn
+// it into a single (unaligned) load or store.
+
+template< class T >
+struct native_field
+{
+    typedef T value_type;
+
+    static value_type load( unsigned char const * ptr ) span_noexcept
+    {
+        value_type value;
+        std::memcpy( &value, ptr, sizeof( value_type ) );
+        return value;
+    }
+
+    static void store( unsigned char * ptr, value_type value ) span_noexcept
+    {
+        std::memcpy( ptr, &value, sizeof( value_type ) );
+    }
+};
+
+// A reference to a value of a writable unaligned_span:
+
+template< class Field >
+class unaligned_reference
+{
+public:
+    typedef typename Field::value_type value_type;
+
+    span_constexpr explicit unaligned_reference( unsigned char * ptr ) span_noexcept
+        : ptr_( ptr )
+    {}
+
+    // a copy refers to the same field, whereas assignment writes the field:
+
+    span_constexpr unaligned_reference( unaligned_reference const & other ) span_noexcept
+        : ptr_( other.ptr_ )
+    {}
+
+    operator value_type() const span_noexcept
+    {
+        return Field::load( ptr_ );
+    }
+
+    unaligned_reference & operator=( value_type value ) span_noexcept
+    {
+        Field::store( ptr_, value );
+        return *this;
+    }
+
+    unaligned_reference & operator=( unaligned_reference const & other ) span_noexcept
+    {
+        Field::store( ptr_, other );
+        return *this;
+    }
+
+private:
+    unsigned char * ptr_;
+};
+
+namespace detail {
+
+// T selects read-write access, T const read-only access:
+
+template< class T, class Field >
+struct unaligned_access
+{
+    typedef unsigned char byte_pointee;
+    typedef unaligned_reference< Field > reference;
+
+    static reference deref( byte_pointee * ptr ) span_noexcept
+    {
+        return reference( ptr );
+    }
+};
+
+template< class T, class Field >
+struct unaligned_access< T const, Field >
+{
+    typedef unsigned char const byte_pointee;
+    typedef typename Field::value_type reference;
+
+    static reference deref( byte_pointee * ptr ) span_noexcept
+    {
+        return Field::load( ptr );
+    }
+};
+
+}  // namespace detail
+
+// Dereferencing yields the value for T const and an unaligned_reference for T:
+
+template< class T, class Field >
+class unaligned_iterator
+{
+public:
+    typedef std::random_access_iterator_tag iterator_category;
+    typedef typename Field::value_type value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef void pointer;
+    typedef typename detail::unaligned_access< T, Field >::reference reference;
+    typedef typename detail::unaligned_access< T, Field >::byte_pointee byte_pointee;
+
+    span_constexpr unaligned_iterator() span_noexcept
+        : ptr_( span_nullptr )
+    {}
+
+    span_constexpr explicit unaligned_iterator( byte_pointee * ptr ) span_noexcept
+        : ptr_( ptr )
+    {}
+
+    reference operator*() const span_noexcept
+    {
+        return detail::unaligned_access< T, Field >::deref( ptr_ );
+    }
+
+    reference operator[]( difference_type n ) const span_noexcept
+    {
+        return detail::unaligned_access< T, Field >::deref( ptr_ + n * stride() );
+    }
+
+    span_constexpr14 unaligned_iterator & operator++() span_noexcept
+    {
+        ptr_ += stride();
+        return *this;
+    }
+
+    span_constexpr14 unaligned_iterator operator++( int ) span_noexcept
+    {
+        unaligned_iterator result( *this );
+        ptr_ += stride();
+        return result;
+    }
+
+    span_constexpr14 unaligned_iterator & operator--() span_noexcept
+    {
+        ptr_ -= stride();
+        return *this;
+    }
+
+    span_constexpr14 unaligned_iterator operator--( int ) span_noexcept
+    {
+        unaligned_iterator result( *this );
+        ptr_ -= stride();
+        return result;
+    }
+
+    span_constexpr14 unaligned_iterator & operator+=( difference_type n ) span_noexcept
+    {
+        ptr_ += n * stride();
+        return *this;
+    }
+
+    span_constexpr14 unaligned_iterator & operator-=( difference_type n ) span_noexcept
+    {
+        ptr_ -= n * stride();
+        return *this;
+    }
+
+    friend span_constexpr unaligned_iterator operator+( unaligned_iterator it, difference_type n ) span_noexcept
+    {
+        return unaligned_iterator( it.ptr_ + n * stride() );
+    }
+
+    friend span_constexpr unaligned_iterator operator+( difference_type n, unaligned_iterator it ) span_noexcept
+    {
+        return unaligned_iterator( it.ptr_ + n * stride() );
+    }
+
+    friend span_constexpr unaligned_iterator operator-( unaligned_iterator it, difference_type n ) span_noexcept
+    {
+        return unaligned_iterator( it.ptr_ - n * stride() );
+    }
+
+    friend span_constexpr difference_type operator-( unaligned_iterator const & a, unaligned_iterator const & b ) span_noexcept
+    {
+        return ( a.ptr_ - b.ptr_ ) / stride();
+    }
+
+    friend span_constexpr bool operator==( unaligned_iterator const & a, unaligned_iterator const & b ) span_noexcept
+    {
+        return a.ptr_ == b.ptr_;
+    }
+
+    friend span_constexpr bool operator!=( unaligned_iterator const & a, unaligned_iterator const & b ) span_noexcept
+    {
+        return a.ptr_ != b.ptr_;
+    }
+
+    friend span_constexpr bool operator<( unaligned_iterator const & a, unaligned_iterator const & b ) span_noexcept
+    {
+        return a.ptr_ < b.ptr_;
+    }
+
+    friend span_constexpr bool operator<=( unaligned_iterator const & a, unaligned_iterator const & b ) span_noexcept
+    {
+        return a.ptr_ <= b.ptr_;
+    }
+
+    friend span_constexpr bool operator>( unaligned_iterator const & a, unaligned_iterator const & b ) span_noexcept
+    {
+        return a.ptr_ > b.ptr_;
+    }
+
+    friend span_constexpr bool operator>=( unaligned_iterator const & a, unaligned_iterator const & b ) span_noexcept
+    {
+        return a.ptr_ >= b.ptr_;
+    }
+
+private:
+    static span_constexpr difference_type stride() span_noexcept
+    {
+        return static_cast< difference_type >( sizeof( value_type ) );
+    }
+
+    byte_pointee * ptr_;
+};
+
+// The values are in the byte order of the platform by default; for a given
+// byte order specify an endian_field, e.g.:
+// unaligned_span< std::uint32_t const, uint32_be > ids( record.first( 4 * count ) );
+
+template< class T, class Field = native_field< typename std11::remove_cv< T >::type > >
+class unaligned_span
+{
+public:
+    typedef T element_type;
+    typedef typename Field::value_type value_type;
+    typedef size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef typename detail::unaligned_access< T, Field >::reference reference;
+    typedef unaligned_iterator< T, Field > iterator;
+#if span_HAVE( BYTE ) || span_HAVE( NONSTD_BYTE )
+    typedef std17::byte byte_type;
+#else
+    typedef unsigned char byte_type;
+#endif
+
+private:
+    typedef typename detail::unaligned_access< T, Field >::byte_pointee byte_pointee;
+
+public:
+    span_constexpr unaligned_span() span_noexcept
+        : data_( span_nullptr )
+        , size_( 0 )
+    {}
+
+    // from a span of a byte type, e.g. std::byte const, unsigned char const, char const;
+    // the size must be a multiple of sizeof( value_type ):
+
+    template< class B, extent_t Extent >
+    explicit unaligned_span( span< B, Extent > bytes )
+        : data_( reinterpret_cast< byte_pointee * >( bytes.data() ) )  // NOLINT
+        , size_( bytes.size() / sizeof( value_type ) )
+    {
+#if span_HAVE( STATIC_ASSERT )
+        static_assert( sizeof( B ) == 1, "unaligned_span: B must be a byte type, e.g. std::byte const" );
+        static_assert( std11::is_same< typename std11::remove_cv< T >::type, value_type >::value, "unaligned_span: T must be the value type of Field" );
+#endif
+        span_EXPECTS( bytes.size() % sizeof( value_type ) == 0 );
+    }
+
+    // observers:
+
+    span_constexpr size_type size() const span_noexcept
+    {
+        return size_;
+    }
+
+    span_constexpr size_type size_bytes() const span_noexcept
+    {
+        return size_ * sizeof( value_type );
+    }
+
+    span_nodiscard span_constexpr bool empty() const span_noexcept
+    {
+        return size_ == 0;
+    }
+
+    // element access:
+
+    reference operator[]( size_type idx ) const
+    {
+        span_EXPECTS( idx < size_ );
+
+        return detail::unaligned_access< T, Field >::deref( data_ + idx * sizeof( value_type ) );
+    }
+
+    value_type load( size_type idx ) const
+    {
+        span_EXPECTS( idx < size_ );
+
+        return Field::load( data_ + idx * sizeof( value_type ) );
+    }
+
+    void store( size_type idx, value_type value ) const
+    {
+        span_EXPECTS( idx < size_ );
+
+        Field::store( data_ + idx * sizeof( value_type ), value );
+    }
+
+    // subviews:
+
+    unaligned_span first( size_type count ) const
+    {
+        span_EXPECTS( count <= size_ );
+
+        return unaligned_span( data_, count );
+    }
+
+    unaligned_span last( size_type count ) const
+    {
+        span_EXPECTS( count <= size_ );
+
+        return unaligned_span( data_ + ( size_ - count ) * sizeof( value_type ), count );
+    }
+
+    unaligned_span subspan( size_type offset, size_type count = dynamic_extent ) const
+    {
+        span_EXPECTS( offset <= size_ && ( count == dynamic_extent || count <= size_ - offset ) );
+
+        return unaligned_span( data_ + offset * sizeof( value_type ), count == dynamic_extent ? size_ - offset : count );
+    }
+
+    // the underlying bytes:
+
+    span< byte_type const > bytes() const span_noexcept
+    {
+        return span< byte_type const >( detail::unchecked, reinterpret_cast< byte_type const * >( data_ ), size_bytes() );  // NOLINT
+    }
+
+    // bulk conversion to and from values in their natural alignment; a copy
+    // without byte swap is a single memcpy(), a copy with byte swap a plain
+    // loop that compilers vectorize for targets with a byte shuffle (SSSE3, NEON).
+    // copy_from() requires a writable view:
+
+    void copy_to( span< value_type > values ) const
+    {
+        span_EXPECTS( size_ <= values.size() );
+
+        copy_to( values.data(), Field() );
+    }
+
+    void copy_from( span< value_type const > values ) const
+    {
+#if span_HAVE( STATIC_ASSERT )
+        static_assert( std11::is_same< byte_pointee, unsigned char >::value, "unaligned_span: copy_from() requires a writable view, T must not be const" );
+#endif
+        span_EXPECTS( values.size() <= size_ );
+
+        copy_from( values.data(), values.size(), Field() );
+    }
+
+    // iterator support:
+
+    iterator begin() const span_noexcept
+    {
+        return iterator( data_ );
+    }
+
+    iterator end() const span_noexcept
+    {
+        return iterator( data_ + size_bytes() );
+    }
+
+private:
+    span_constexpr unaligned_span( byte_pointee * ptr, size_type count ) span_noexcept
+        : data_( ptr )
+        , size_( count )
+    {}
+
+    void copy_to( value_type * dest, native_field< value_type > ) const span_noexcept
+    {
+        // an empty view or span may have a null pointer, which memcpy() does not accept:
+
+        if ( size_ != 0 )
+        {
+            std::memcpy( dest, data_, size_bytes() );
+        }
+    }
+
+    template< class F >
+    void copy_to( value_type * dest, F ) const span_noexcept
+    {
+        for ( size_type i = 0; i < size_; ++i )
+        {
+            dest[ i ] = Field::load( data_ + i * sizeof( value_type ) );
+        }
+    }
+
+    void copy_from( value_type const * src, size_type count, native_field< value_type > ) const span_noexcept
+    {
+        if ( count != 0 )
+        {
+            std::memcpy( data_, src, count * sizeof( value_type ) );
+        }
+    }
+
+    template< class F >
+    void copy_from( value_type const * src, size_type count, F ) const span_noexcept
+    {
+        for ( size_type i = 0; i < count; ++i )
+        {
+            Field::store( data_ + i * sizeof( value_type ), src[ i ] );
+        }
+    }
+
+    byte_pointee * data_;
+    size_type size_;
+};
+
+#endif // span_FEATURE( UNALIGNED_SPAN )
+
+// chunks, windows, chunks_exact [span-lite extension]: views on consecutive sub spans of a span:
+
+#if span_FEATURE( CHUNKS )
+
+// Note: the bounds are validated once when the view is created;
+// the sub spans are created without further checks.
+
+template< class T, extent_t Extent = dynamic_extent >
+class chunk_iterator
+{
+public:
+    // operator->() yields a sub span created on the fly:
+
+    class arrow_proxy
+    {
+    public:
+        span_constexpr explicit arrow_proxy( span< T, Extent > const & spn ) span_noexcept
+            : spn_( spn )
+        {}
+
+        span_constexpr span< T, Extent > const * operator->() const span_noexcept
+        {
+            return &spn_;
+        }
+
+    private:
+        span< T, Extent > spn_;
+    };
+
+    typedef std::random_access_iterator_tag iterator_category;
+    typedef span< T, Extent > value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef arrow_proxy pointer;
+    typedef value_type reference;
+
+    typedef size_t size_type;
+
+    span_constexpr chunk_iterator() span_noexcept
+        : data_( span_nullptr )
+        , size_( 0 )
+        , step_( 1 )
+        , width_( 0 )
+        , index_( 0 )
+    {}
+
+    span_constexpr chunk_iterator( T * ptr, size_type size, size_type step, size_type width, size_type index ) span_noexcept
+        : data_( ptr )
+        , size_( size )
+        , step_( step )
+        , width_( width )
+        , index_( index )
+    {}
+
+    span_constexpr reference operator*() const span_noexcept
+    {
+        return at_index( index_ );
+    }
+
+    span_constexpr pointer operator->() const span_noexcept
+    {
+        return pointer( at_index( index_ ) );
+    }
+
+    span_constexpr reference operator[]( difference_type n ) const span_noexcept
+    {
+        return at_index( index_ + static_cast<size_type>( n ) );
+    }
+
+    span_constexpr14 chunk_iterator & operator++() span_noexcept
+    {
+        ++index_;
+        return *this;
+    }
+
+    span_constexpr14 chunk_iterator operator++( int ) span_noexcept
+    {
+        chunk_iterator result( *this );
+        ++index_;
+        return result;
+    }
+
+    span_constexpr14 chunk_iterator & operator--() span_noexcept
+    {
+        --index_;
+        return *this;
+    }
+
+    span_constexpr14 chunk_iterator operator--( int ) span_noexcept
+    {
+        chunk_iterator result( *this );
+        --index_;
+        return result;
+    }
+
+    span_constexpr14 chunk_iterator & operator+=( difference_type n ) span_noexcept
+    {
+        index_ += static_cast<size_type>( n );
+        return *this;
+    }
+
+    span_constexpr14 chunk_iterator & operator-=( difference_type n ) span_noexcept
+    {
+        index_ -= static_cast<size_type>( n );
+        return *this;
+    }
+
+    friend span_constexpr chunk_iterator operator+( chunk_iterator it, difference_type n ) span_noexcept
+    {
+        return chunk_iterator( it.data_, it.size_, it.step_, it.width_, it.index_ + static_cast<size_type>( n ) );
+    }
+
+    friend span_constexpr chunk_iterator operator+( difference_type n, chunk_iterator it ) span_noexcept
+    {
+        return chunk_iterator( it.data_, it.size_, it.step_, it.width_, it.index_ + static_cast<size_type>( n ) );
+    }
+
+    friend span_constexpr chunk_iterator operator-( chunk_iterator it, difference_type n ) span_noexcept
+    {
+        return chunk_iterator( it.data_, it.size_, it.step_, it.width_, it.index_ - static_cast<size_type>( n ) );
+    }
+
+    friend span_constexpr difference_type operator-( chunk_iterator const & a, chunk_iterator const & b ) span_noexcept
+    {
+        return static_cast<difference_type>( a.index_ ) - static_cast<difference_type>( b.index_ );
+    }
+
+    friend span_constexpr bool operator==( chunk_iterator const & a, chunk_iterator const & b ) span_noexcept
+    {
+        return a.index_ == b.index_;
+    }
+
+    friend span_constexpr bool operator!=( chunk_iterator const & a, chunk_iterator const & b ) span_noexcept
+    {
+        return a.index_ != b.index_;
+    }
+
+    friend span_constexpr bool operator<( chunk_iterator const & a, chunk_iterator const & b ) span_noexcept
+    {
+        return a.index_ < b.index_;
+    }
+
+    friend span_constexpr bool operator<=( chunk_iterator const & a, chunk_iterator const & b ) span_noexcept
+    {
+        return a.index_ <= b.index_;
+    }
+
+    friend span_constexpr bool operator>( chunk_iterator const & a, chunk_iterator const & b ) span_noexcept
+    {
+        return a.index_ > b.index_;
+    }
+
+    friend span_constexpr bool operator>=( chunk_iterator const & a, chunk_iterator const & b ) span_noexcept
+    {
+        return a.index_ >= b.index_;
+    }
+
+private:
+    // a chunk at the end may be shorter than width_, except for chunks of static extent:
+
+    span_constexpr value_type at_index( size_type idx ) const span_noexcept
+    {
+        return value_type( detail::unchecked, data_ + idx * step_,
+            Extent != dynamic_extent || width_ <= size_ - idx * step_ ? width_ : size_ - idx * step_ );
+    }
+
+    T *       data_;
+    size_type size_;
+    size_type step_;
+    size_type width_;
+    size_type index_;
+};
+
+template< class T, extent_t Extent = dynamic_extent >
+class chunk_view
+{
+public:
+    typedef span< T, Extent > value_type;
+    typedef size_t size_type;
+
+    typedef chunk_iterator< T, Extent > iterator;
+    typedef iterator const_iterator;
+
+    span_constexpr chunk_view() span_noexcept
+        : data_( span_nullptr )
+        , size_( 0 )
+        , step_( 1 )
+        , width_( 0 )
+        , count_( 0 )
+    {}
+
+    span_constexpr chunk_view( T * ptr, size_type size, size_type step, size_type width, size_type count ) span_noexcept
+        : data_( ptr )
+        , size_( size )
+        , step_( step )
+        , width_( width )
+        , count_( count )
+    {}
+
+    // number of sub spans:
+
+    span_constexpr size_type size() const span_noexcept
+    {
+        return count_;
+    }
+
+    span_nodiscard span_constexpr bool empty() const span_noexcept
+    {
+        return count_ == 0;
+    }
+
+    span_constexpr_exp value_type operator[]( size_type idx ) const
+    {
+        span_EXPECTS( idx < size() );
+
+        return begin()[ static_cast<std::ptrdiff_t>( idx ) ];
+    }
+
+    span_constexpr iterator begin() const span_noexcept
+    {
+        return iterator( data_, size_, step_, width_, 0 );
+    }
+
+    span_constexpr iterator end() const span_noexcept
+    {
+        return iterator( data_, size_, step_, width_, count_ );
+    }
+
+    // the trailing elements that are not part of any sub span:
+
+    span_constexpr span< T > remainder() const span_noexcept
+    {
+        return span< T >( detail::unchecked, data_ + covered(), size_ - covered() );
+    }
+
+private:
+    span_constexpr size_type covered() const span_noexcept
+    {
+        return count_ == 0 ? 0 : ( count_ - 1 ) * step_ + width_ <= size_ ? ( count_ - 1 ) * step_ + width_ : size_;
+    }
+
+    T *       data_;
+    size_type size_;
+    size_type step_;
+    size_type width_;
+    size_type count_;
+};
+
+// consecutive, non-overlapping sub spans of n elements; the last one may be shorter:
+
+template< class T, extent_t Extent >
+span_constexpr_exp chunk_view< T > chunks( span< T, Extent > spn, size_t n )
+{
+    span_EXPECTS( n > 0 );
+
+    return chunk_view< T >( spn.data(), spn.size(), n, n, spn.size() / n + ( spn.size() % n != 0 ) );
+}
+
+// overlapping sub spans of n elements, starting at each consecutive element:
+
+template< class T, extent_t Extent >
+span_constexpr_exp chunk_view< T > windows( span< T, Extent > spn, size_t n )
+{
+    span_EXPECTS( n > 0 );
+
+    return chunk_view< T >( spn.data(), spn.size(), 1, n, spn.size() >= n ? spn.size() - n + 1 : 0 );
+}
+
+// consecutive, non-overlapping sub spans of static extent N; see remainder() for the rest:
+
+template< extent_t N, class T, extent_t Extent >
+span_constexpr_exp chunk_view< T, N > chunks_exact( span< T, Extent > spn )
+{
+#if span_HAVE( STATIC_ASSERT )
+    static_assert( N != dynamic_extent && N > 0, "chunks_exact<N>(): N must be a positive static extent" );
+#endif
+    span_EXPECTS( N != dynamic_extent && N > 0 );
+
+    return chunk_view< T, N >( spn.data(), spn.size(), to_size( N ), to_size( N ), spn.size() / to_size( N ) );
+}
+
+#endif // span_FEATURE( CHUNKS )
+
+// mdspan [span-lite extension]: a multidimensional view on a contiguous sequence (C++11):
+
+#if span_FEATURE( MDSPAN ) && span_CPP11_120
+
+template< extent_t... Extents >
+class extents;
+
+namespace detail {
+
+// number of dynamic extents:
+
+template< extent_t... Extents >
+struct count_dynamic_extents : std::integral_constant< std::size_t, 0 > {};
+
+template< extent_t E, extent_t... Extents >
+struct count_dynamic_extents< E, Extents... >
+    : std::integral_constant< std::size_t, ( E == dynamic_extent ? 1 : 0 ) + count_dynamic_extents< Extents... >::value > {};
+
+// static extent of rank R:
+
+template< std::size_t R, extent_t... Extents >
+struct static_extent_of;
+
+template< extent_t E, extent_t... Extents >
+struct static_extent_of< 0, E, Extents... > : std::integral_constant< extent_t, E > {};
+
+template< std::size_t R, extent_t E, extent_t... Extents >
+struct static_extent_of< R, E, Extents... > : static_extent_of< R - 1, Extents... > {};
+
+// index of the dynamic extent of rank R in the storage of dynamic extents:
+
+template< std::size_t R, extent_t... Extents >
+struct dynamic_extent_index;
+
+template<>
+struct dynamic_extent_index< 0 > : std::integral_constant< std::size_t, 0 > {};
+
+template< extent_t E, extent_t... Extents >
+struct dynamic_extent_index< 0, E, Extents... > : std::integral_constant< std::size_t, 0 > {};
+
+template< std::size_t R, extent_t E, extent_t... Extents >
+struct dynamic_extent_index< R, E, Extents... >
+    : std::integral_constant< std::size_t, ( E == dynamic_extent ? 1 : 0 ) + dynamic_extent_index< R - 1, Extents... >::value > {};
+
+// static extent of rank r, given at run time:
+
+inline span_constexpr extent_t nth_static_extent( std::size_t /*r*/ ) span_noexcept
+{
+    return dynamic_extent;
+}
+
+template< class... Extents >
+inline span_constexpr extent_t nth_static_extent( std::size_t r, extent_t e, Extents... es ) span_noexcept
+{
+    return r == 0 ? e : nth_static_extent( r - 1, es... );
+}
+
+// storage for dynamic extents, empty if there are none:
+
+template< std::size_t N >
+struct dynamic_extents_storage
+{
+    size_t values[ N ];
+
+    span_constexpr size_t get( std::size_t k ) const span_noexcept
+    {
+        return values[ k ];
+    }
+};
+
+template<>
+struct dynamic_extents_storage< 0 >
+{
+    // never called: all extents are static
+
+    span_constexpr size_t get( std::size_t /*k*/ ) const span_noexcept
+    {
+        return 0;
+    }
+};
+
+// extents of dynamic rank:
+
+template< std::size_t Rank, extent_t... Extents >
+struct make_dextents : make_dextents< Rank - 1, dynamic_extent, Extents... > {};
+
+template< extent_t... Extents >
+struct make_dextents< 0, Extents... >
+{
+    typedef nonstd::span_lite::extents< Extents... > type;
+};
+
+}  // namespace detail
+
+// extents: the static and dynamic extents of a multidimensional index space:
+
+// The dynamic extents are a base, so that fully static extents are empty.
+
+template< extent_t... Extents >
+class extents : private detail::dynamic_extents_storage< detail::count_dynamic_extents< Extents... >::value >
+{
+    typedef detail::dynamic_extents_storage< detail::count_dynamic_extents< Extents... >::value > storage_type;
+
+public:
+    typedef size_t      size_type;
+    typedef std::size_t rank_type;
+
+    static span_constexpr rank_type rank() span_noexcept
+    {
+        return sizeof...( Extents );
+    }
+
+    static span_constexpr rank_type rank_dynamic() span_noexcept
+    {
+        return detail::count_dynamic_extents< Extents... >::value;
+    }
+
+    static span_constexpr extent_t static_extent( rank_type r ) span_noexcept
+    {
+        return detail::nth_static_extent( r, Extents... );
+    }
+
+    span_constexpr extents() span_noexcept
+        : storage_type()
+    {}
+
+    template< class... Sizes
+        span_REQUIRES_T((
+            sizeof...( Sizes ) > 0 && sizeof...( Sizes ) == detail::count_dynamic_extents< Extents... >::value
+        ))
+    >
+    span_constexpr explicit extents( Sizes... sizes ) span_noexcept
+        : storage_type( { { static_cast<size_type>( sizes )... } } )
+    {}
+
+    // extent of rank R; a static extent folds to a constant:
+
+    template< rank_type R >
+    span_constexpr size_type extent() const span_noexcept
+    {
+        return detail::static_extent_of< R, Extents... >::value != dynamic_extent
+            ? static_cast<size_type>( detail::static_extent_of< R, Extents... >::value )
+            : this->get( detail::dynamic_extent_index< R, Extents... >::value );
+    }
+
+    span_constexpr14 size_type extent( rank_type r ) const span_noexcept
+    {
+        rank_type k = 0;
+        for ( rank_type i = 0; i < r; ++i )
+        {
+            if ( static_extent( i ) == dynamic_extent )
+            {
+                ++k;
+            }
+        }
+        return static_extent( r ) != dynamic_extent ? static_cast<size_type>( static_extent( r ) ) : this->get( k );
+    }
+
+    // number of elements in the index space:
+
+    span_constexpr14 size_type size() const span_noexcept
+    {
+        size_type result = 1;
+        for ( rank_type r = 0; r < rank(); ++r )
+        {
+            result *= extent( r );
+        }
+        return result;
+    }
+};
+
+#if span_HAVE( ALIAS_TEMPLATE )
+
+template< std::size_t Rank >
+using dextents = typename detail::make_dextents< Rank >::type;
+
+#endif
+
+// layout_right: row-major layout, the rightmost index varies fastest:
+
+struct layout_right
+{
+    template< class Extents >
+    class mapping
+    {
+    public:
+        typedef Extents extents_type;
+        typedef typename extents_type::size_type size_type;
+        typedef typename extents_type::rank_type rank_type;
+        typedef layout_right layout_type;
+
+        span_constexpr mapping() span_noexcept
+            : extents_()
+        {}
+
+        span_constexpr mapping( extents_type const & e ) span_noexcept
+            : extents_( e )
+        {}
+
+        span_constexpr extents_type const & extents() const span_noexcept
+        {
+            return extents_;
+        }
+
+        span_constexpr14 size_type required_span_size() const span_noexcept
+        {
+            return extents_.size();
+        }
+
+        template< class... Indices >
+        span_constexpr size_type operator()( Indices... idx ) const span_noexcept
+        {
+            return offset<0>( 0, idx... );
+        }
+
+        span_constexpr14 size_type stride( rank_type r ) const span_noexcept
+        {
+            size_type result = 1;
+            for ( rank_type k = r + 1; k < extents_type::rank(); ++k )
+            {
+                result *= extents_.extent( k );
+            }
+            return result;
+        }
+
+        static span_constexpr bool is_always_unique()     span_noexcept { return true; }
+        static span_constexpr bool is_always_exhaustive() span_noexcept { return true; }
+        static span_constexpr bool is_always_strided()    span_noexcept { return true; }
+
+    private:
+        template< rank_type R >
+        span_constexpr size_type offset( size_type acc ) const span_noexcept
+        {
+            return acc;
+        }
+
+        template< rank_type R, class Index, class... Indices >
+        span_constexpr size_type offset( size_type acc, Index i, Indices... idx ) const span_noexcept
+        {
+            return offset< R + 1 >( acc * extents_.template extent<R>() + static_cast<size_type>( i ), idx... );
+        }
+
+        extents_type extents_;
+    };
+};
+
+// layout_left: column-major layout, the leftmost index varies fastest:
+
+struct layout_left
+{
+    template< class Extents >
+    class mapping
+    {
+    public:
+        typedef Extents extents_type;
+        typedef typename extents_type::size_type size_type;
+        typedef typename extents_type::rank_type rank_type;
+        typedef layout_left layout_type;
+
+        span_constexpr mapping() span_noexcept
+            : extents_()
+        {}
+
+        span_constexpr mapping( extents_type const & e ) span_noexcept
+            : extents_( e )
+        {}
+
+        span_constexpr extents_type const & extents() const span_noexcept
+        {
+            return extents_;
+        }
+
+        span_constexpr14 size_type required_span_size() const span_noexcept
+        {
+            return extents_.size();
+        }
+
+        template< class... Indices >
+        span_constexpr size_type operator()( Indices... idx ) const span_noexcept
+        {
+            return offset<0>( idx... );
+        }
+
+        span_constexpr14 size_type stride( rank_type r ) const span_noexcept
+        {
+            size_type result = 1;
+            for ( rank_type k = 0; k < r; ++k )
+            {
+                result *= extents_.extent( k );
+            }
+            return result;
+        }
+
+        static span_constexpr bool is_always_unique()     span_noexcept { return true; }
+        static span_constexpr bool is_always_exhaustive() span_noexcept { return true; }
+        static span_constexpr bool is_always_strided()    span_noexcept { return true; }
+
+    private:
+        template< rank_type R >
+        span_constexpr size_type offset() const span_noexcept
+        {
+            return 0;
+        }
+
+        template< rank_type R, class Index >
+        span_constexpr size_type offset( Index i ) const span_noexcept
+        {
+            return static_cast<size_type>( i );
+        }
+
+        template< rank_type R, class Index, class Index2, class... Indices >
+        span_constexpr size_type offset( Index i, Index2 i2, Indices... idx ) const span_noexcept
+        {
+            return static_cast<size_type>( i ) + extents_.template extent<R>() * offset< R + 1 >( i2, idx... );
+        }
+
+        extents_type extents_;
+    };
+};
+
+// layout_stride: layout with a user-specified stride per rank:
+
+struct layout_stride
+{
+    template< class Extents >
+    class mapping
+    {
+    public:
+        typedef Extents extents_type;
+        typedef typename extents_type::size_type size_type;
+        typedef typename extents_type::rank_type rank_type;
+        typedef layout_stride layout_type;
+        typedef std::array< size_type, Extents::rank() > strides_type;
+
+        span_constexpr mapping() span_noexcept
+            : extents_()
+            , strides_()
+        {}
+
+        span_constexpr mapping( extents_type const & e, strides_type const & s ) span_noexcept
+            : extents_( e )
+            , strides_( s )
+        {}
+
+        span_constexpr extents_type const & extents() const span_noexcept
+        {
+            return extents_;
+        }
+
+        span_constexpr strides_type const & strides() const span_noexcept
+        {
+            return strides_;
+        }
+
+        span_constexpr14 size_type required_span_size() const span_noexcept
+        {
+            size_type result = 1;
+            for ( rank_type r = 0; r < extents_type::rank(); ++r )
+            {
+                if ( extents_.extent( r ) == 0 )
+                {
+                    return 0;
+                }
+                result += ( extents_.extent( r ) - 1 ) * strides_[ r ];
+            }
+            return result;
+        }
+
+        template< class... Indices >
+        span_constexpr size_type operator()( Indices... idx ) const span_noexcept
+        {
+            return offset<0>( idx... );
+        }
+
+        span_constexpr size_type stride( rank_type r ) const span_noexcept
+        {
+            return strides_[ r ];
+        }
+
+        static span_constexpr bool is_always_unique()     span_noexcept { return false; }
+        static span_constexpr bool is_always_exhaustive() span_noexcept { return false; }
+        static span_constexpr bool is_always_strided()    span_noexcept { return true; }
+
+    private:
+        template< rank_type R >
+        span_constexpr size_type offset() const span_noexcept
+        {
+            return 0;
+        }
+
+        template< rank_type R, class Index, class... Indices >
+        span_constexpr size_type offset( Index i, Indices... idx ) const span_noexcept
+        {
+            return static_cast<size_type>( i ) * strides_[ R ] + offset< R + 1 >( idx... );
+        }
+
+        extents_type extents_;
+        strides_type strides_;
+    };
+};
+
+// mdspan: a multidimensional view via an extents and a layout mapping:
+
+template< class T, class Extents, class LayoutPolicy = layout_right >
+class mdspan
+{
+public:
+    typedef Extents extents_type;
+    typedef LayoutPolicy layout_type;
+    typedef typename layout_type::template mapping< extents_type > mapping_type;
+
+    typedef T element_type;
+    typedef typename std11::remove_cv< T >::type value_type;
+    typedef T * pointer;
+    typedef T & reference;
+    typedef T * data_handle_type;
+
+    typedef typename extents_type::size_type size_type;
+    typedef typename extents_type::rank_type rank_type;
+
+    span_constexpr mdspan() span_noexcept
+        : data_( span_nullptr )
+        , map_()
+    {}
+
+    template< class... Sizes
+        span_REQUIRES_T((
+            sizeof...( Sizes ) == extents_type::rank_dynamic()
+        ))
+    >
+    span_constexpr explicit mdspan( pointer ptr, Sizes... sizes ) span_noexcept
+        : data_( ptr )
+        , map_( extents_type( sizes... ) )
+    {}
+
+    span_constexpr mdspan( pointer ptr, extents_type const & e ) span_noexcept
+        : data_( ptr )
+        , map_( e )
+    {}
+
+    span_constexpr mdspan( pointer ptr, mapping_type const & m ) span_noexcept
+        : data_( ptr )
+        , map_( m )
+    {}
+
+    template< class... Sizes
+        span_REQUIRES_T((
+            sizeof...( Sizes ) == extents_type::rank_dynamic()
+        ))
+    >
+    span_constexpr_exp explicit mdspan( span< T > spn, Sizes... sizes )
+        : data_( spn.data() )
+        , map_( extents_type( sizes... ) )
+    {
+        span_EXPECTS( map_.required_span_size() <= spn.size() );
+    }
+
+    span_constexpr_exp mdspan( span< T > spn, mapping_type const & m )
+        : data_( spn.data() )
+        , map_( m )
+    {
+        span_EXPECTS( map_.required_span_size() <= spn.size() );
+    }
+
+    // element access, with a bounds check per index:
+
+    template< class... Indices
+        span_REQUIRES_T((
+            sizeof...( Indices ) == extents_type::rank()
+        ))
+    >
+    span_constexpr_exp reference operator()( Indices... idx ) const
+    {
+        span_EXPECTS( in_range<0>( idx... ) );
+
+        return data_[ map_( idx... ) ];
+    }
+
+    // observers:
+
+    static span_constexpr rank_type rank() span_noexcept
+    {
+        return extents_type::rank();
+    }
+
+    static span_constexpr rank_type rank_dynamic() span_noexcept
+    {
+        return extents_type::rank_dynamic();
+    }
+
+    static span_constexpr extent_t static_extent( rank_type r ) span_noexcept
+    {
+        return extents_type::static_extent( r );
+    }
+
+    span_constexpr14 size_type extent( rank_type r ) const span_noexcept
+    {
+        return extents().extent( r );
+    }
+
+    span_constexpr14 size_type size() const span_noexcept
+    {
+        return extents().size();
+    }
+
+    span_nodiscard span_constexpr14 bool empty() const span_noexcept
+    {
+        return size() == 0;
+    }
+
+    span_constexpr14 size_type stride( rank_type r ) const span_noexcept
+    {
+        return map_.stride( r );
+    }
+
+    span_constexpr extents_type const & extents() const span_noexcept
+    {
+        return map_.extents();
+    }
+
+    span_constexpr mapping_type const & mapping() const span_noexcept
+    {
+        return map_;
+    }
+
+    span_constexpr data_handle_type data_handle() const span_noexcept
+    {
+        return data_;
+    }
+
+    // the viewed elements as a span:
+
+    span_constexpr14 span< element_type > to_span() const
+    {
+        return span< element_type >( data_, map_.required_span_size() );
+    }
+
+private:
+    template< rank_type R >
+    span_constexpr bool in_range() const span_noexcept
+    {
+        return true;
+    }
+
+    template< rank_type R, class Index, class... Indices >
+    span_constexpr bool in_range( Index i, Indices... idx ) const span_noexcept
+    {
+        return detail::is_positive( i )
+            && static_cast<size_type>( i ) < extents().template extent<R>()
+            && in_range< R + 1 >( idx... );
+    }
+
+    pointer      data_;
+    mapping_type map_;
+};
+
+#endif // span_FEATURE( MDSPAN )
+
+}  // namespace span_lite
+}  // namespace nonstd
+
+// make available in nonstd:
+
+namespace nonstd {
+
+using span_lite::dynamic_extent;
+
+using span_lite::span;
+
+using span_lite::with_container;
+
+#if span_FEATURE( COMPARISON )
+#if span_FEATURE( SAME )
+using span_lite::same;
+#endif
+
+using span_lite::operator==;
+using span_lite::operator!=;
+using span_lite::operator<;
+using span_lite::operator<=;
+using span_lite::operator>;
+using span_lite::operator>=;
+#endif
+
+#if span_HAVE( BYTE )
+using span_lite::as_bytes;
+using span_lite::as_writable_bytes;
+#endif
+
+using span_lite::size;
+using span_lite::ssize;
+
+#if span_CONFIG( CONTRACT_VIOLATION_CALLS_HANDLER )
+using span_lite::contract_violation_handler;
+using span_lite::get_contract_violation_handler;
+using span_lite::set_contract_violation_handler;
+#endif
+
+#if span_HAVE( CONTRACT_VIOLATION_COUNTS )
+using span_lite::contract_violation_count;
+using span_lite::contract_violation_counts;
+using span_lite::reset_contract_violation_counts;
+#endif
+
+#if span_FEATURE( STRIDED_SPAN )
+using span_lite::strided_span;
+using span_lite::strided_iterator;
+using span_lite::stride;
+#endif
+
+#if span_FEATURE( UNCHECKED_ACCESS ) || span_FEATURE( BYTE_READER ) || span_FEATURE( BYTE_WRITER )
+using span_lite::checked_policy;
+using span_lite::unchecked_policy;
+#endif
+
+#if span_FEATURE( UNCHECKED_ACCESS )
+using span_lite::at;
+using span_lite::first;
+using span_lite::last;
+using span_lite::subspan;
+#endif
+
+#if span_FEATURE( HASH ) && span_CPP11_120
+using span_lite::span_hash;
+using span_lite::span_equal;
+using span_lite::span_identity_hash;
+using span_lite::span_identity_equal;
+#endif
+
+#if span_FEATURE( ALIGNED_SPAN )
+using span_lite::aligned_span;
+using span_lite::make_aligned_span;
+#endif
+
+#if span_FEATURE( NOALIAS_SPAN )
+using span_lite::overlaps;
+using span_lite::noalias_span;
+using span_lite::make_noalias_span;
+#endif
+
+#if span_FEATURE( BIT_SPAN )
+using span_lite::bit_span;
+using span_lite::bit_reference;
+using span_lite::bitwise_and;
+using span_lite::bitwise_or;
+using span_lite::bitwise_xor;
+#endif
+
+#if span_FEATURE( RING_VIEW )
+using span_lite::ring_view;
+using span_lite::ring_iterator;
+using span_lite::ring_regions;
+using span_lite::ring_readable;
+using span_lite::ring_writable;
+#endif
+
+#if span_FEATURE( SPAN_LIST )
+using span_lite::span_list;
+using span_lite::span_list_position;
+#endif
+
+#if span_HAVE( MAPPED_FILE )
+using span_lite::mapped_file;
+#endif
+
+#if span_FEATURE( BYTE_READER ) || span_FEATURE( BYTE_WRITER ) || span_FEATURE( UNALIGNED_SPAN )
+using span_lite::endian_field;
+using span_lite::uint16_le;
+using span_lite::uint16_be;
+using span_lite::uint32_le;
+using span_lite::uint32_be;
+# if span_CPP11_120
+using span_lite::uint64_le;
+using span_lite::uint64_be;
+# endif
+#endif
+
+#if span_FEATURE( BYTE_READER )
+using span_lite::basic_byte_reader;
+using span_lite::byte_reader;
+using span_lite::unchecked_byte_reader;
+#endif
+
+#if span_FEATURE( BYTE_WRITER )
+using span_lite::basic_byte_writer;
+using span_lite::byte_writer;
+using span_lite::unchecked_byte_writer;
+#endif
+
+#if span_FEATURE( SPANSTREAM )
+using span_lite::basic_spanbuf;
+using span_lite::basic_ispanstream;
+using span_lite::basic_ospanstream;
+using span_lite::basic_spanstream;
+using span_lite::spanbuf;
+using span_lite::wspanbuf;
+using span_lite::ispanstream;
+using span_lite::wispanstream;
+using span_lite::ospanstream;
+using span_lite::wospanstream;
+using span_lite::spanstream;
+using span_lite::wspanstream;
+#endif
+
+#if span_FEATURE( MONOTONIC_ARENA )
+using span_lite::monotonic_arena;
+# if span_HAVE( MEMORY_RESOURCE )
+using span_lite::monotonic_arena_resource;
+# endif
+#endif
+
+#if span_FEATURE( SPAN_VECTOR )
+using span_lite::span_vector;
+using span_lite::uninitialized_storage_t;
+using span_lite::uninitialized_storage;
+#endif
+
+#if span_FEATURE( AS_SPAN )
+using span_lite::ElementsExtent;
+using span_lite::as_span;
+using span_lite::as_writable_span;
+#endif
+
+#if span_FEATURE( UNALIGNED_SPAN )
+using span_lite::native_field;
+using span_lite::unaligned_reference;
+using span_lite::unaligned_iterator;
+using span_lite::unaligned_span;
+#endif
+
+#if span_FEATURE( CHUNKS )
+using span_lite::chunk_view;
+using span_lite::chunk_iterator;
+using span_lite::chunks;
+using span_lite::windows;
+using span_lite::chunks_exact;
+#endif
+
+#if span_FEATURE( MDSPAN ) && span_CPP11_120
+using span_lite::extents;
+# if span_HAVE( ALIAS_TEMPLATE )
+using span_lite::dextents;
+# endif
+using span_lite::layout_right;
+using span_lite::layout_left;
+using span_lite::layout_stride;
+using span_lite::mdspan;
+#endif
+
+}  // namespace nonstd
+
+#endif  // span_USES_STD_SPAN
+
+// make_span() [span-lite extension]:
+
+#if span_FEATURE( MAKE_SPAN ) || span_FEATURE( NON_MEMBER_FIRST_LAST_SUB_SPAN ) || span_FEATURE( NON_MEMBER_FIRST_LAST_SUB_CONTAINER )
+
+#if span_USES_STD_SPAN
+# define  span_constexpr  constexpr
+# define  span_noexcept   noexcept
+# define  span_nullptr    nullptr
+# ifndef  span_CONFIG_EXTENT_TYPE
 #  define span_CONFIG_EXTENT_TYPE  std::size_t
 # endif
 using extent_t = span_CONFIG_EXTENT_TYPE;
@@ -1761,7 +7383,7 @@ last( span<T, Extent> spn, size_t count )
 }
 
 template< size_t Offset, extent_t Count, class T, extent_t Extent >
-span_constexpr span<T, Count>
+span_constexpr span<T, Count != dynamic_extent ? Count : ( Extent != dynamic_extent ? Extent - static_cast<extent_t>( Offset ) : dynamic_extent )>
 subspan( span<T, Extent> spn )
 {
     return spn.template subspan<Offset, Count>();
@@ -0,0 +1,81 @@
+# Codegen regression test: compile kernels to assembly and verify that each
+# span_<name> kernel has no more instructions than its raw_<name> counterpart.
+#
+# https://github.com/martinmoene/span-lite
+#
+# Distributed under the Boost Software License, Version 1.0.
+# (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+#
+# Usage: cmake -DCXX=<compiler> -DSTD=<98|11|...> -DSOURCE=<file.cpp> -DINCLUDE=<dir>
+#              -DOUTPUT=<file.s> [-DDEFINITIONS=<-Da;-Db>] [-DCONTRACTS=ON] -P codegen.cmake
+
+foreach( var CXX STD SOURCE INCLUDE OUTPUT )
+    if( NOT DEFINED ${var} )
+        message( FATAL_ERROR "codegen.cmake: missing -D${var}=..." )
+    endif()
+endforeach()
+
+# Contract checks are disabled: they intentionally add instructions; with
+# CONTRACTS=ON they are kept, to verify checks that must fold away.
+
+if( CONTRACTS )
+    set( contract_level "" )
+else()
+    set( contract_level -Dspan_CONFIG_CONTRACT_LEVEL_OFF )
+endif()
+
+execute_process(
+    COMMAND ${CXX} -std=c++${STD} -O2 -S -fno-asynchronous-unwind-tables
+            ${contract_level} ${DEFINITIONS} -I${INCLUDE} ${SOURCE} -o ${OUTPUT}
+    RESULT_VARIABLE result
+    ERROR_VARIABLE  errors
+)
+
+if( NOT result EQUAL 0 )
+    message( FATAL_ERROR "codegen.cmake: compilation failed:\n${errors}" )
+endif()
+
+# Count the instructions of each kernel; local labels and directives start with '.':
+
+file( STRINGS ${OUTPUT} lines )
+
+set( kernels "" )
+set( current "" )
+
+foreach( line IN LISTS lines )
+    if( line MATCHES "^_?((raw|span)_[A-Za-z0-9_]+):" )
+        set( current ${CMAKE_MATCH_1} )
+        set( count_${current} 0 )
+        list( APPEND kernels ${current} )
+    elseif( line MATCHES "^\t\\.size" OR line MATCHES "^[A-Za-z_][A-Za-z0-9_]*:" )
+        set( current "" )
+    elseif( current AND line MATCHES "^\t[a-z]" )
+        math( EXPR count_${current} "${count_${current}} + 1" )
+    endif()
+endforeach()
+
+# Compare each span kernel with its raw counterpart:
+
+set( failures 0 )
+
+foreach( kernel IN LISTS kernels )
+    if( kernel MATCHES "^span_(.*)$" )
+        set( name ${CMAKE_MATCH_1} )
+
+        if( NOT DEFINED count_raw_${name} )
+            message( SEND_ERROR "codegen: ${kernel}: no counterpart raw_${name}" )
+            math( EXPR failures "${failures} + 1" )
+        elseif( count_${kernel} GREATER count_raw_${name} )
+            message( SEND_ERROR "codegen: ${kernel}: ${count_${kernel}} instructions, raw_${name}: ${count_raw_${name}}" )
+            math( EXPR failures "${failures} + 1" )
+        else()
+            message( STATUS "codegen: ${kernel}: ${count_${kernel}} instructions, raw_${name}: ${count_raw_${name}}" )
+        endif()
+    endif()
+endforeach()
+
+if( failures GREATER 0 )
+    message( FATAL_ERROR "codegen: ${failures} kernel(s) with more instructions than their raw-pointer counterpart (see ${OUTPUT})" )
+endif()
+
+# end of file
@@ -0,0 +1,65 @@
+// Kernels for codegen regression tests with contract checks enabled: the
+// checks of each span_* kernel must fold away, so that it does not compile
+// to more instructions than its raw-pointer counterpart raw_*.
+//
+// https://github.com/martinmoene/span-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "nonstd/span.hpp"
+#include <cstring>
+
+using nonstd::span;
+
+// compile-time subviews of a span of static extent (C++11):
+
+extern "C" int raw_static_subviews( int const * ptr )
+{
+    return ptr[0] + ptr[7] + ptr[3];
+}
+
+extern "C" int span_static_subviews( span<int const, 8> spn )
+{
+    span<int const, 4> head = spn.first<4>();
+    span<int const, 2> tail = spn.last<2>();
+    span<int const, 2> mid  = spn.subspan<2, 2>();
+
+    return head[0] + tail[1] + mid[1];
+}
+
+// decode records after a single check of their size via can_read() (GNU C++, clang):
+
+#if span_FEATURE( BYTE_READER )
+
+extern "C" unsigned raw_sum_records( unsigned char const * ptr, std::size_t size )
+{
+    unsigned sum = 0;
+
+    for ( ; size >= 6; ptr += 6, size -= 6 )
+    {
+        unsigned short type;
+        unsigned       length;
+        std::memcpy( &type  , ptr    , sizeof type   );
+        std::memcpy( &length, ptr + 2, sizeof length );
+        sum += __builtin_bswap16( type ) + __builtin_bswap32( length );
+    }
+    return sum;
+}
+
+extern "C" unsigned span_sum_records( span<unsigned char const> bytes )
+{
+    nonstd::unchecked_byte_reader reader( bytes );
+    unsigned sum = 0;
+
+    while ( reader.can_read( 6 ) )
+    {
+        sum += reader.read< nonstd::uint16_be >();
+        sum += reader.read< nonstd::uint32_be >();
+    }
+    return sum;
+}
+
+#endif
+
+// end of file
@@ -0,0 +1,215 @@
+// Kernels for codegen regression tests: each span_* kernel must not compile
+// to more instructions than its raw-pointer counterpart raw_*.
+//
+// https://github.com/martinmoene/span-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "nonstd/span.hpp"
+#include <cstring>
+#include <vector>
+
+using nonstd::span;
+
+// sum via operator[]:
+
+extern "C" int raw_sum_index( int const * ptr, std::size_t size )
+{
+    int sum = 0;
+    for ( std::size_t i = 0; i < size; ++i )
+        sum += ptr[i];
+    return sum;
+}
+
+extern "C" int span_sum_index( span<int const> spn )
+{
+    int sum = 0;
+    for ( std::size_t i = 0; i < spn.size(); ++i )
+        sum += spn[i];
+    return sum;
+}
+
+// sum via iterators:
+
+extern "C" int raw_sum_iterate( int const * ptr, std::size_t size )
+{
+    int sum = 0;
+    for ( int const * pos = ptr; pos != ptr + size; ++pos )
+        sum += *pos;
+    return sum;
+}
+
+extern "C" int span_sum_iterate( span<int const> spn )
+{
+    int sum = 0;
+    for ( span<int const>::iterator pos = spn.begin(); pos != spn.end(); ++pos )
+        sum += *pos;
+    return sum;
+}
+
+// sum of the first element of consecutive sub sequences via subspan():
+
+extern "C" int raw_sum_subspan( int const * ptr, std::size_t size, std::size_t n )
+{
+    int sum = 0;
+    for ( std::size_t offset = 0; offset + n <= size; offset += n )
+        sum += ( ptr + offset )[0];
+    return sum;
+}
+
+extern "C" int span_sum_subspan( span<int const> spn, std::size_t n )
+{
+    int sum = 0;
+    for ( std::size_t offset = 0; offset + n <= spn.size(); offset += n )
+        sum += spn.subspan( offset, n )[0];
+    return sum;
+}
+
+// sum of a span of static extent:
+
+extern "C" int raw_sum_fixed( int const * ptr )
+{
+    return ptr[0] + ptr[1] + ptr[2] + ptr[3];
+}
+
+extern "C" int span_sum_fixed( span<int const, 4> spn )
+{
+    return spn[0] + spn[1] + spn[2] + spn[3];
+}
+
+// sum of a std::vector via make_span():
+
+extern "C" int raw_sum_vector( std::vector<int> const & vec )
+{
+#if span_CPP11_OR_GREATER
+    int const * ptr  = vec.data();
+#else
+    int const * ptr  = vec.empty() ? 0 : &vec[0];
+#endif
+    std::size_t size = vec.size();
+    int sum = 0;
+    for ( std::size_t i = 0; i < size; ++i )
+        sum += ptr[i];
+    return sum;
+}
+
+extern "C" int span_sum_vector( std::vector<int> const & vec )
+{
+    span<int const> spn = nonstd::make_span( vec );
+    int sum = 0;
+    for ( std::size_t i = 0; i < spn.size(); ++i )
+        sum += spn[i];
+    return sum;
+}
+
+// scale a sequence known to be 32-byte aligned (GNU C++, clang):
+
+#if span_FEATURE( ALIGNED_SPAN )
+
+extern "C" void raw_scale_aligned( float * ptr, std::size_t size, float factor )
+{
+    float * aligned = static_cast<float *>( __builtin_assume_aligned( ptr, 32 ) );
+    for ( std::size_t i = 0; i < size; ++i )
+        aligned[i] *= factor;
+}
+
+extern "C" void span_scale_aligned( nonstd::aligned_span<float, 32> spn, float factor )
+{
+    for ( std::size_t i = 0; i < spn.size(); ++i )
+        spn[i] *= factor;
+}
+
+#endif
+
+// accumulate a sequence into a non-overlapping one:
+
+#if span_FEATURE( NOALIAS_SPAN )
+
+extern "C" void raw_axpy_noalias( float * span_RESTRICT dst, float const * span_RESTRICT src, std::size_t size, float factor )
+{
+    for ( std::size_t i = 0; i < size; ++i )
+        dst[i] += factor * src[i];
+}
+
+extern "C" void span_axpy_noalias( nonstd::noalias_span<float> dst, nonstd::noalias_span<float const> src, float factor )
+{
+    for ( std::size_t i = 0; i < dst.size(); ++i )
+        dst[i] += factor * src[i];
+}
+
+#endif
+
+// decode big-endian 32-bit integers from a byte cursor (GNU C++, clang):
+
+#if span_FEATURE( BYTE_READER )
+
+extern "C" unsigned raw_read_u32be( unsigned char const ** pos )
+{
+    unsigned value;
+    std::memcpy( &value, *pos, sizeof value );
+    *pos += sizeof value;
+    return __builtin_bswap32( value );
+}
+
+extern "C" unsigned span_read_u32be( nonstd::byte_reader & reader )
+{
+    return reader.read< nonstd::uint32_be >();
+}
+
+#endif
+
+// encode big-endian 32-bit integers into a byte cursor (GNU C++, clang):
+
+#if span_FEATURE( BYTE_WRITER )
+
+extern "C" void raw_write_u32be( unsigned char ** pos, unsigned value )
+{
+    value = __builtin_bswap32( value );
+    std::memcpy( *pos, &value, sizeof value );
+    *pos += sizeof value;
+}
+
+extern "C" void span_write_u32be( nonstd::byte_writer & writer, unsigned value )
+{
+    writer.write< nonstd::uint32_be >( value );
+}
+
+#endif
+
+// load a 32-bit integer from any address:
+
+#if span_FEATURE( UNALIGNED_SPAN )
+
+extern "C" unsigned raw_load_unaligned( unsigned char const * ptr, std::size_t idx )
+{
+    unsigned value;
+    std::memcpy( &value, ptr + idx * sizeof value, sizeof value );
+    return value;
+}
+
+extern "C" unsigned span_load_unaligned( nonstd::unaligned_span<unsigned const> values, std::size_t idx )
+{
+    return values[idx];
+}
+
+// decode packed big-endian 32-bit integers (GNU C++, clang):
+
+extern "C" void raw_decode_u32be( unsigned * dst, unsigned char const * src, std::size_t size )
+{
+    for ( std::size_t i = 0; i < size; ++i )
+    {
+        unsigned value;
+        std::memcpy( &value, src + i * sizeof value, sizeof value );
+        dst[i] = __builtin_bswap32( value );
+    }
+}
+
+extern "C" void span_decode_u32be( span<unsigned> dst, nonstd::unaligned_span<unsigned const, nonstd::uint32_be> src )
+{
+    src.copy_to( dst );
+}
+
+#endif
+
+// end of file
@@ -73,6 +73,24 @@ CASE( "Presence of span library features" "[.span][.config]" )
     span_PRESENT( span_FEATURE_NON_MEMBER_FIRST_LAST_SUB );
     span_PRESENT( span_FEATURE_COMPARISON );
     span_PRESENT( span_FEATURE_SAME );
+    span_PRESENT( span_FEATURE_STRIDED_SPAN );
+    span_PRESENT( span_FEATURE_MDSPAN );
+    span_PRESENT( span_FEATURE_CHUNKS );
+    span_PRESENT( span_FEATURE_HASH );
+    span_PRESENT( span_FEATURE_UNCHECKED_ACCESS );
+    span_PRESENT( span_FEATURE_ALIGNED_SPAN );
+    span_PRESENT( span_FEATURE_NOALIAS_SPAN );
+    span_PRESENT( span_FEATURE_BIT_SPAN );
+    span_PRESENT( span_FEATURE_RING_VIEW );
+    span_PRESENT( span_FEATURE_SPAN_LIST );
+    span_PRESENT( span_FEATURE_MAPPED_FILE );
+    span_PRESENT( span_FEATURE_BYTE_READER );
+    span_PRESENT( span_FEATURE_BYTE_WRITER );
+    span_PRESENT( span_FEATURE_SPANSTREAM );
+    span_PRESENT( span_FEATURE_MONOTONIC_ARENA );
+    span_PRESENT( span_FEATURE_SPAN_VECTOR );
+    span_PRESENT( span_FEATURE_AS_SPAN );
+    span_PRESENT( span_FEATURE_UNALIGNED_SPAN );
 }
 
 CASE( "span configuration, contract level" "[.span][.config][.contract]" )
@@ -116,6 +134,8 @@ CASE( "span configuration, contract level" "[.span][.config][.contract]" )
 #else
     span_ABSENT( span_CONFIG_CONTRACT_VIOLATION_TERMINATES );
 #endif
+    span_PRESENT( span_CONFIG_CONTRACT_VIOLATION_CALLS_HANDLER );
+    span_PRESENT( span_CONFIG_CONTRACT_VIOLATION_COUNTS );
 }
 
 CASE( "__cplusplus" "[.stdc++]" )
@@ -13,6 +13,10 @@
 #include <memory>   // std::unique_ptr
 #include "span-main.t.hpp"
 
+#if span_CPP11_OR_GREATER
+# include <unordered_map>
+#endif
+
 #define DIMENSION_OF( a ) ( sizeof(a) / sizeof(0[a]) )
 
 #define span_STD_OR(     expr )  ( span_USES_STD_SPAN) || ( expr )
@@ -167,6 +171,23 @@ CASE( "span<>: Throws  on access outside the span via at(): std::out_of_range [s
 #endif
 }
 
+CASE( "span<>: Terminates construction of a span of static extent from a non-matching size" )
+{
+#if !span_USES_STD_SPAN
+    struct F {
+        static void blow_count() { int arr[] = { 1, 2, 3, }; span<int, 2> v( &arr[0], 3 ); }
+        static void blow_range() { int arr[] = { 1, 2, 3, }; span<int, 2> v( &arr[0], &arr[0] + 3 ); }
+        static void blow_conv()  { int arr[] = { 1, 2, 3, }; span<int> v( arr ); span<int, 2> w( v ); }
+    };
+
+    EXPECT_THROWS( F::blow_count() );
+    EXPECT_THROWS( F::blow_range() );
+    EXPECT_THROWS( F::blow_conv()  );
+#else
+    EXPECT( !!"No exception, using std::span" );
+#endif
+}
+
 CASE( "span<>: Termination throws std::logic_error-derived exception [span_CONFIG_CONTRACT_VIOLATION_THROWS=1]" )
 {
 #if span_NONSTD_AND( span_CONFIG( CONTRACT_VIOLATION_THROWS_V ) )
@@ -180,6 +201,130 @@ CASE( "span<>: Termination throws std::logic_error-derived exception [span_CONFI
 #endif
 }
 
+CASE( "span<>: Contract violation calls the installed handler [span_CONFIG_CONTRACT_VIOLATION_CALLS_HANDLER=1]" )
+{
+#if span_NONSTD_AND( span_CONFIG( CONTRACT_VIOLATION_CALLS_HANDLER ) )
+    struct F {
+        static char const * & message() { static char const * msg = span_nullptr; return msg; }
+        static void log( char const * msg ) { message() = msg; }
+    };
+    int arr[] = { 1, 2, 3, };
+    span<int> v( arr );
+
+    contract_violation_handler const previous = set_contract_violation_handler( &F::log );
+
+    span<int> w = v.first( 4 );
+
+    EXPECT( (set_contract_violation_handler( previous ) == &F::log) );
+    EXPECT( (F::message() != span_nullptr) );
+    EXPECT( std::string( F::message() ).find( "Precondition violation" ) != std::string::npos );
+    EXPECT( w.size() == 4u );
+#else
+    EXPECT( !!"contract violation handler is not available (span_CONFIG_CONTRACT_VIOLATION_CALLS_HANDLER=0, or using std::span)" );
+#endif
+}
+
+CASE( "span<>: Contract violation handler reverts to the default handler for a null pointer [span_CONFIG_CONTRACT_VIOLATION_CALLS_HANDLER=1]" )
+{
+#if span_NONSTD_AND( span_CONFIG( CONTRACT_VIOLATION_CALLS_HANDLER ) && span_CONFIG( CONTRACT_VIOLATION_THROWS_V ) )
+    struct F {
+        static void ignore( char const * ) {}
+        static void blow() { int arr[] = { 1, }; span<int> v( arr ); (void) v[1]; }
+    };
+
+    contract_violation_handler const previous = set_contract_violation_handler( &F::ignore );
+
+    set_contract_violation_handler( span_nullptr );
+
+    EXPECT( (get_contract_violation_handler() == previous) );
+    EXPECT_THROWS_AS( F::blow(), nonstd::span_lite::detail::contract_violation );
+#else
+    EXPECT( !!"contract violation handler is not available (span_CONFIG_CONTRACT_VIOLATION_CALLS_HANDLER=0, non-throwing contract violation, or using std::span)" );
+#endif
+}
+
+CASE( "span<>: Contract violations are counted per call site [span_CONFIG_CONTRACT_VIOLATION_COUNTS=1]" )
+{
+#if span_NONSTD_AND( span_HAVE( CONTRACT_VIOLATION_COUNTS ) && span_CONFIG( CONTRACT_VIOLATION_CALLS_HANDLER ) )
+    struct F {
+        static void ignore( char const * ) {}
+        static void blow_first( span<int> v ) { (void) v.first( 4 ); }
+        static void blow_last ( span<int> v ) { (void) v.last ( 4 ); }
+    };
+    int arr[] = { 1, 2, 3, };
+    span<int> v( arr );
+
+    contract_violation_handler const previous = set_contract_violation_handler( &F::ignore );
+    reset_contract_violation_counts();
+
+    // the same call site twice:
+    for ( volatile int i = 0; i < 2; i = i + 1 )
+    {
+        F::blow_first( v );
+    }
+    F::blow_last( v );
+
+    set_contract_violation_handler( previous );
+
+    contract_violation_count counts[ span_CONFIG_CONTRACT_VIOLATION_COUNTS_SITES ];
+    size_t const sites = contract_violation_counts( counts, span_CONFIG_CONTRACT_VIOLATION_COUNTS_SITES );
+
+    unsigned long total = 0, most = 0; size_t violated = 0;
+    for ( size_t i = 0; i < sites; ++i )
+    {
+        if ( counts[i].count == 0 )
+            continue;
+        ++violated;
+        total += counts[i].count;
+        most = (std::max)( most, counts[i].count );
+    }
+
+    EXPECT( violated == 2u );
+    EXPECT( total    == 3u );
+    EXPECT( most     == 2u );
+#else
+    EXPECT( !!"contract violation counts are not available (span_CONFIG_CONTRACT_VIOLATION_COUNTS=0, before C++11, or using std::span)" );
+#endif
+}
+
+CASE( "span<>: Contract violations of the same check are counted per call site (optimized GNU C++, clang) [span_CONFIG_CONTRACT_VIOLATION_COUNTS=1]" )
+{
+#if span_NONSTD_AND( span_HAVE( CONTRACT_VIOLATION_COUNTS ) && span_CONFIG( CONTRACT_VIOLATION_CALLS_HANDLER ) ) && defined( __OPTIMIZE__ )
+    struct F {
+        static void ignore( char const * ) {}
+        static void blow_here ( span<int> v ) { (void) v.first( 4 ); }
+        static void blow_there( span<int> v ) { (void) v.first( 5 ); }
+    };
+    int arr[] = { 1, 2, 3, };
+    span<int> v( arr );
+
+    contract_violation_handler const previous = set_contract_violation_handler( &F::ignore );
+    reset_contract_violation_counts();
+
+    F::blow_here ( v );
+    F::blow_there( v );
+
+    set_contract_violation_handler( previous );
+
+    contract_violation_count counts[ span_CONFIG_CONTRACT_VIOLATION_COUNTS_SITES ];
+    size_t const sites = contract_violation_counts( counts, span_CONFIG_CONTRACT_VIOLATION_COUNTS_SITES );
+
+    size_t violated = 0; bool have_address = true;
+    for ( size_t i = 0; i < sites; ++i )
+    {
+        if ( counts[i].count == 0 )
+            continue;
+        ++violated;
+        have_address = have_address && counts[i].address != span_nullptr;
+    }
+
+    EXPECT( violated == 2u );
+    EXPECT( have_address );
+#else
+    EXPECT( !!"contract violation counts per call site are not available (span_CONFIG_CONTRACT_VIOLATION_COUNTS=0, before C++11, not optimized, or using std::span)" );
+#endif
+}
+
 CASE( "span<>: Allows to default-construct" )
 {
     span<int> v;
@@ -1285,6 +1430,35 @@ CASE( "span<>: Allows to compare empty spans as equal [span_FEATURE_COMPARISON=1
 #endif
 }
 
+CASE( "span<>: Allows to compare spans of bytes and of integers as by memcmp() [span_FEATURE_COMPARISON=1]" )
+{
+#if span_NONSTD_AND( span_FEATURE( COMPARISON ))
+    unsigned char a[] = { 0x01, 0x80, 0x00, };
+    unsigned char b[] = { 0x01, 0x7f, 0xff, };
+    unsigned char c[] = { 0x01, 0x80, };
+    unsigned char d[] = { 0x01, 0x80, 0x00, };
+    int           x[] = { -1, 2, 3, };
+    int           y[] = {  1, 2, 3, };
+    int const     z[] = { -1, 2, 3, };
+
+    span<unsigned char> va( a ), vb( b ), vc( c ), vd( d );
+    span<int> vx( x ), vy( y );
+    span<int const> vz( z );
+
+    EXPECT(     va == vd  );
+    EXPECT(     va != vb  );
+    EXPECT(     vb <  va  );
+    EXPECT(     vc <  va  );
+    EXPECT(  !( va <  vc ) );
+    EXPECT(     vx <  vy  );
+    EXPECT(  !( vy <  vx ) );
+    EXPECT(     vx == vz  );
+    EXPECT(  !( vx <  vz ) );
+#else
+    EXPECT( !!"comparison is not available (span_FEATURE_COMPARISON=0)" );
+#endif
+}
+
 CASE( "span<>: Allows to test for empty span via empty(), empty case" )
 {
     span<int> v;
@@ -1332,6 +1506,92 @@ CASE( "span<>: Allows to obtain the number of elements via ssize()" )
 #endif
 }
 
+CASE( "span<>: Terminates construction of a span of static extent from a nullptr and a zero size (C++11)" )
+{
+#if span_NONSTD_AND( span_HAVE( NULLPTR ) )
+    struct F { static void blow() { span<int, 3> v( nullptr, 0 ); } };
+
+    EXPECT_THROWS( F::blow() );
+#else
+    EXPECT( !!"nullptr is not available (no C++11), or no exception, using std::span)" );
+#endif
+}
+
+CASE( "span<>: Terminates construction of a span of static extent from a std::initializer_list<> of another size (C++11, p2447)" )
+{
+#if span_HAVE( INITIALIZER_LIST ) && !span_BETWEEN( span_COMPILER_MSVC_VERSION, 120, 130 )
+#if span_NONSTD_AND( span_FEATURE( WITH_INITIALIZER_LIST_P2447 ) )
+    struct F {
+        static void blow_n( size_type n ) { if ( n == 2 ) { span<const int, 3> v( { 1, 2, } ); (void) v; } else { span<const int, 3> v( { 1, 2, 3, } ); (void) v; } }
+    };
+
+    EXPECT_NO_THROW( F::blow_n( 3 ) );
+    EXPECT_THROWS(   F::blow_n( 2 ) );
+#else
+    EXPECT( !!"construction from std::initializer_list is not available (span_FEATURE_WITH_INITIALIZER_LIST_P2447, or using std::span)" );
+#endif
+#else
+    EXPECT( !!"std::initializer_list<> is not available (no C++11)" );
+#endif
+}
+
+CASE( "span<>: Allows a span of static extent to have the size of a pointer" )
+{
+#if !span_USES_STD_SPAN
+#if span_HAVE( STATIC_ASSERT )
+    static_assert( sizeof( span<int, 3> ) == sizeof( int * ), "span<int, 3> is not pointer-sized" );
+    static_assert( sizeof( span<int   > ) == sizeof( int * ) + sizeof( size_type ), "span<int> is not pointer and size" );
+#endif
+    int a[] = { 1, 2, 3, };
+
+    span<int, 3> v( a );
+    span<int   > w( v );
+
+    EXPECT( sizeof( v ) == sizeof( int * ) );
+    EXPECT( sizeof( w ) == sizeof( int * ) + sizeof( size_type ) );
+    EXPECT( v.size()    == size_type( 3 ) );
+    EXPECT( w.size()    == size_type( 3 ) );
+    EXPECT( v.data()    == &a[0] );
+#else
+    EXPECT( !!"layout of span is implementation-defined (using std::span)" );
+#endif
+}
+
+CASE( "span<>: Allows to obtain the static extent via size() of a span of static extent" )
+{
+    int a[] = { 1, 2, 3, 4, 5, };
+
+    span<int, 5> v( a );
+    span<int, 2> f = v.first<2>();
+    span<int, 3> l = v.last<3>();
+    span<int, 0> z;
+
+    EXPECT( v.size() == size_type( 5 ) );
+    EXPECT( f.size() == size_type( 2 ) );
+    EXPECT( l.size() == size_type( 3 ) );
+    EXPECT( z.size() == size_type( 0 ) );
+    EXPECT( l.data() == &a[2] );
+}
+
+CASE( "span<>: Allows to obtain a sub span of static extent via subspan<>() of a span of static extent" )
+{
+    int a[] = { 1, 2, 3, 4, 5, };
+
+    span<int, 5> v( a );
+    span<int, 4> s = v.subspan<1, dynamic_extent>();
+    span<int, 2> t = v.subspan<1, 2>();
+    span<int, 0> e = v.subspan<5, dynamic_extent>();
+
+    EXPECT( s.size() == size_type( 4 ) );
+    EXPECT( t.size() == size_type( 2 ) );
+    EXPECT( e.size() == size_type( 0 ) );
+    EXPECT( s.data() == &a[1] );
+    EXPECT( t.data() == &a[1] );
+#if span_NONSTD_AND( span_HAVE( STATIC_ASSERT ) )
+    static_assert( decltype( v.subspan<1, dynamic_extent>() )::extent == 4, "subspan<1>() of span<int,5> must have extent 4" );
+#endif
+}
+
 CASE( "span<>: Allows to obtain the number of bytes via size_bytes()" )
 {
     int a[] = { 1, 2, 3, };
@@ -2103,6 +2363,2611 @@ CASE( "get<I>(spn): Allows to access an element via std::get<>()" )
 #endif
 }
 
+CASE( "unchecked access [span_FEATURE_UNCHECKED_ACCESS=1]" )
+{
+    EXPECT( !!"(avoid warning)" );  // suppress: unused parameter 'lest_env' [-Wunused-parameter]
+}
+
+CASE( "span<>: Allows to access elements and to create sub spans without checks via unchecked_at(), unchecked_first(), unchecked_last() and unchecked_subspan()" )
+{
+#if span_NONSTD_AND( span_FEATURE( UNCHECKED_ACCESS ) )
+    int arr[] = { 1, 2, 3, 4, 5, };
+    span<int> v( arr );
+
+    EXPECT( v.unchecked_at( 2 ) == 3 );
+    EXPECT( v.unchecked_first( 2 ).size() == size_type( 2 ) );
+    EXPECT( v.unchecked_first( 2 ).data() == &arr[0] );
+    EXPECT( v.unchecked_last( 2 ).data()  == &arr[3] );
+    EXPECT( v.unchecked_subspan( 1, 3 ).size() == size_type( 3 ) );
+    EXPECT( v.unchecked_subspan( 1, 3 ).data() == &arr[1] );
+    EXPECT( v.unchecked_subspan( 1 ).size() == size_type( 4 ) );
+#else
+    EXPECT( !!"unchecked access is not available (span_FEATURE_UNCHECKED_ACCESS=0, or using std::span)" );
+#endif
+}
+
+CASE( "at<>(), first<>(), last<>(), subspan<>(): Terminates access outside the span with checked_policy" )
+{
+#if span_NONSTD_AND( span_FEATURE( UNCHECKED_ACCESS ) )
+    struct F {
+        static void blow_at()      { int arr[] = { 1, 2, 3, }; (void) at     <checked_policy>( span<int>( arr ), 3 ); }
+        static void blow_first()   { int arr[] = { 1, 2, 3, }; (void) first  <checked_policy>( span<int>( arr ), 4 ); }
+        static void blow_last()    { int arr[] = { 1, 2, 3, }; (void) last   <checked_policy>( span<int>( arr ), 4 ); }
+        static void blow_offset()  { int arr[] = { 1, 2, 3, }; (void) subspan<checked_policy>( span<int>( arr ), 4 ); }
+        static void blow_count()   { int arr[] = { 1, 2, 3, }; (void) subspan<checked_policy>( span<int>( arr ), 1, 3 ); }
+    };
+
+    EXPECT_THROWS( F::blow_at() );
+    EXPECT_THROWS( F::blow_first() );
+    EXPECT_THROWS( F::blow_last() );
+    EXPECT_THROWS( F::blow_offset() );
+    EXPECT_THROWS( F::blow_count() );
+#else
+    EXPECT( !!"unchecked access is not available (span_FEATURE_UNCHECKED_ACCESS=0, or using std::span)" );
+#endif
+}
+
+CASE( "at<>(), first<>(), last<>(), subspan<>(): Allows to choose checked or unchecked access per call via a policy" )
+{
+#if span_NONSTD_AND( span_FEATURE( UNCHECKED_ACCESS ) )
+    int arr[] = { 1, 2, 3, 4, 5, };
+    span<int> v( arr );
+
+    EXPECT( at<checked_policy  >( v, 4 ) == 5 );
+    EXPECT( at<unchecked_policy>( v, 4 ) == 5 );
+    EXPECT( first<unchecked_policy>( v, 2 ).data() == &arr[0] );
+    EXPECT( last <unchecked_policy>( v, 2 ).data() == &arr[3] );
+    EXPECT( subspan<unchecked_policy>( v, 1, 2 ).size() == size_type( 2 ) );
+    EXPECT( subspan<checked_policy  >( v, 1 ).size()    == size_type( 4 ) );
+
+    int sum = 0;
+    for ( size_type i = 0; i < v.size(); ++i )
+    {
+        sum += at<unchecked_policy>( v, i );
+    }
+    EXPECT( sum == 15 );
+#else
+    EXPECT( !!"unchecked access is not available (span_FEATURE_UNCHECKED_ACCESS=0, or using std::span)" );
+#endif
+}
+
+CASE( "span_hash [span_FEATURE_HASH=1]" )
+{
+    EXPECT( !!"(avoid warning)" );  // suppress: unused parameter 'lest_env' [-Wunused-parameter]
+}
+
+CASE( "span_hash: Allows to hash the content of a span consistent with its equality" )
+{
+#if span_NONSTD_AND( span_FEATURE( HASH ) ) && span_CPP11_120
+    int a[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, };
+    int b[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, };
+    int c[] = { 1, 2, 3, 4, 5, 6, 7, 8, 0, };
+
+    span_hash  hash;
+    span_equal equal;
+
+    EXPECT( hash( span<int>( a ) ) == hash( span<int const>( b ) ) );
+    EXPECT( hash( span<int>( a ) ) != hash( span<int>( c ) ) );
+    EXPECT( hash( span<int>( a ).first( 8 ) ) == hash( span<int>( c ).first( 8 ) ) );
+    EXPECT( hash( span<int>( a ).first( 8 ) ) != hash( span<int>( a ).first( 7 ) ) );
+    EXPECT(  equal( span<int>( a ), span<int const>( b ) ) );
+    EXPECT( !equal( span<int>( a ), span<int>( c ) ) );
+#else
+    EXPECT( !!"span_hash is not available (span_FEATURE_HASH=0, no C++11, or using std::span)" );
+#endif
+}
+
+CASE( "span_hash: Disallows equality of spans of different element types (C++17)" )
+{
+#if span_NONSTD_AND( span_FEATURE( HASH ) ) && span_CPP17_OR_GREATER
+    EXPECT((  std::is_invocable< span_equal, span<int>, span<int const> >::value ));
+    EXPECT(( !std::is_invocable< span_equal, span<int>, span<long const> >::value ));
+#else
+    EXPECT( !!"span_hash is not available (span_FEATURE_HASH=0, no C++17, or using std::span)" );
+#endif
+}
+
+CASE( "span_hash: Allows to hash the content of a span of a non-trivial type via std::hash<>" )
+{
+#if span_NONSTD_AND( span_FEATURE( HASH ) ) && span_CPP11_120
+    std::string a[] = { "a", "bc", };
+    std::string b[] = { "a", "bc", };
+    std::string c[] = { "ab", "c", };
+
+    span_hash  hash;
+    span_equal equal;
+
+    EXPECT( hash( span<std::string>( a ) ) == hash( span<std::string>( b ) ) );
+    EXPECT( hash( span<std::string>( a ) ) != hash( span<std::string>( c ) ) );
+    EXPECT(  equal( span<std::string>( a ), span<std::string>( b ) ) );
+    EXPECT( !equal( span<std::string>( a ), span<std::string>( c ) ) );
+#else
+    EXPECT( !!"span_hash is not available (span_FEATURE_HASH=0, no C++11, or using std::span)" );
+#endif
+}
+
+CASE( "span_hash: Allows to hash the identity of a span consistent with same()" )
+{
+#if span_NONSTD_AND( span_FEATURE( HASH ) ) && span_CPP11_120
+    int a[] = { 1, 2, 3, };
+    int b[] = { 1, 2, 3, };
+
+    span_identity_hash  hash;
+    span_identity_equal equal;
+
+    EXPECT( hash( span<int>( a ) ) == hash( span<int const>( a ) ) );
+    EXPECT( hash( span<int>( a ) ) != hash( span<int>( b ) ) );
+    EXPECT( hash( span<int>( a ) ) != hash( span<int>( a ).first( 2 ) ) );
+    EXPECT(  equal( span<int>( a ), span<int>( a ) ) );
+    EXPECT( !equal( span<int>( a ), span<int>( b ) ) );
+    EXPECT( !equal( span<int>( a ), span<int>( a ).first( 2 ) ) );
+#else
+    EXPECT( !!"span_identity_hash is not available (span_FEATURE_HASH=0, no C++11, or using std::span)" );
+#endif
+}
+
+CASE( "span_hash: Allows to probe an unordered_map with vector keys via a span (C++20)" )
+{
+#if span_NONSTD_AND( span_FEATURE( HASH ) ) && span_CPP11_120 && defined( __cpp_lib_generic_unordered_lookup )
+    typedef std::vector<unsigned char> key_type;
+
+    std::unordered_map<key_type, int, span_hash, span_equal> map;
+
+    unsigned char k1[] = { 'a', 'b', 'c', };
+    unsigned char k2[] = { 'x', 'y', };
+
+    map[ key_type( k1, k1 + 3 ) ] = 1;
+    map[ key_type( k2, k2 + 2 ) ] = 2;
+
+    EXPECT( map.find( span<unsigned char const>( k1 ) )->second == 1 );
+    EXPECT( map.find( span<unsigned char const>( k2 ) )->second == 2 );
+    EXPECT( (map.find( span<unsigned char const>( k1 ).first( 2 ) ) == map.end()) );
+#elif span_NONSTD_AND( span_FEATURE( HASH ) ) && span_CPP11_120
+    typedef std::vector<unsigned char> key_type;
+
+    unsigned char k1[] = { 'a', 'b', 'c', };
+
+    span_hash  hash;
+    span_equal equal;
+
+    EXPECT( hash( key_type( k1, k1 + 3 ) ) == hash( span<unsigned char const>( k1 ) ) );
+    EXPECT( equal( key_type( k1, k1 + 3 ), span<unsigned char const>( k1 ) ) );
+#else
+    EXPECT( !!"span_hash is not available (span_FEATURE_HASH=0, no C++11, or using std::span)" );
+#endif
+}
+
+CASE( "strided_span<> [span_FEATURE_STRIDED_SPAN=1]" )
+{
+    EXPECT( !!"(avoid warning)" );  // suppress: unused parameter 'lest_env' [-Wunused-parameter]
+}
+
+CASE( "strided_span<>: Terminates construction with a non-positive stride" )
+{
+#if span_NONSTD_AND( span_FEATURE( STRIDED_SPAN ) )
+    struct F { static void blow() { int arr[] = { 1, 2, 3, }; strided_span<int> v( &arr[0], 3, 0 ); } };
+
+    EXPECT_THROWS( F::blow() );
+#else
+    EXPECT( !!"strided_span<> is not available (span_FEATURE_STRIDED_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "strided_span<>: Terminates combining strides that overflow via stride()" )
+{
+#if span_NONSTD_AND( span_FEATURE( STRIDED_SPAN ) )
+    struct F {
+        static void blow_n(std::ptrdiff_t n) { int arr[] = { 1, }; std::ptrdiff_t const big = static_cast<std::ptrdiff_t>( size_t( -1 ) / 4 + 1 ); (void) stride( strided_span<int>( &arr[0], 1, big ), n ); }
+    };
+
+    EXPECT_NO_THROW( F::blow_n(1) );
+    EXPECT_THROWS(   F::blow_n(2) );
+#else
+    EXPECT( !!"strided_span<> is not available (span_FEATURE_STRIDED_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "strided_span<>: Terminates access outside the strided span" )
+{
+#if span_NONSTD_AND( span_FEATURE( STRIDED_SPAN ) )
+    struct F {
+        static void blow_ix(size_type i) { int arr[] = { 1, 2, 3, 4, 5, }; strided_span<int> v = stride( span<int>( arr ), 2 ); (void) v[i]; }
+    };
+
+    EXPECT_NO_THROW( F::blow_ix(2) );
+    EXPECT_THROWS(   F::blow_ix(3) );
+#else
+    EXPECT( !!"strided_span<> is not available (span_FEATURE_STRIDED_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "strided_span<>: Allows to construct from a pointer, a size and a stride" )
+{
+#if span_NONSTD_AND( span_FEATURE( STRIDED_SPAN ) )
+    int arr[] = { 1, 2, 3, 4, 5, 6, };
+
+    strided_span<int> v( &arr[1], 3, 2 );
+
+    EXPECT( v.size()   == size_type( 3 ) );
+    EXPECT( v.stride() == 2 );
+    EXPECT( v.data()   == &arr[1] );
+    EXPECT( v[0] == 2 );
+    EXPECT( v[1] == 4 );
+    EXPECT( v[2] == 6 );
+#else
+    EXPECT( !!"strided_span<> is not available (span_FEATURE_STRIDED_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "strided_span<>: Allows to construct from a span with unit stride" )
+{
+#if span_NONSTD_AND( span_FEATURE( STRIDED_SPAN ) )
+    int arr[] = { 1, 2, 3, };
+
+    strided_span<const int> v = span<int>( arr );
+
+    EXPECT( v.size()   == size_type( 3 ) );
+    EXPECT( v.stride() == 1 );
+    EXPECT( std::equal( v.begin(), v.end(), &arr[0] ) );
+#else
+    EXPECT( !!"strided_span<> is not available (span_FEATURE_STRIDED_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "strided_span<>: Allows to view a column of a row-major matrix via stride()" )
+{
+#if span_NONSTD_AND( span_FEATURE( STRIDED_SPAN ) )
+    const std::ptrdiff_t cols = 3;
+    int mat[] = {
+        1, 2, 3,
+        4, 5, 6,
+        7, 8, 9,
+        10, 11, 12,
+    };
+    int col1[] = { 2, 5, 8, 11, };
+
+    strided_span<int> v = stride( span<int>( mat ).subspan( 1 ), cols );
+
+    EXPECT( v.size() == size_type( 4 ) );
+    EXPECT( v.front() == 2 );
+    EXPECT( v.back()  == 11 );
+    EXPECT( std::equal( v.begin(), v.end(), &col1[0] ) );
+
+    v[1] = 42;
+
+    EXPECT( mat[4] == 42 );
+#else
+    EXPECT( !!"strided_span<> is not available (span_FEATURE_STRIDED_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "strided_span<>: Allows to de-interleave channels via stride()" )
+{
+#if span_NONSTD_AND( span_FEATURE( STRIDED_SPAN ) )
+    short lr[] = { 1, -1, 2, -2, 3, -3, 4, };
+    short l [] = { 1,  2,  3,  4, };
+    short r [] = { -1, -2, -3, };
+
+    strided_span<short> left  = stride( span<short>( lr ), 2 );
+    strided_span<short> right = stride( span<short>( lr ).subspan( 1 ), 2 );
+
+    EXPECT( left.size()  == size_type( 4 ) );
+    EXPECT( right.size() == size_type( 3 ) );
+    EXPECT( std::equal( left.begin() , left.end() , &l[0] ) );
+    EXPECT( std::equal( right.begin(), right.end(), &r[0] ) );
+#else
+    EXPECT( !!"strided_span<> is not available (span_FEATURE_STRIDED_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "strided_span<>: Allows to combine strides via stride()" )
+{
+#if span_NONSTD_AND( span_FEATURE( STRIDED_SPAN ) )
+    int arr[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, };
+
+    strided_span<int> v = stride( stride( span<int>( arr ), 2 ), 2 );
+
+    EXPECT( v.size()   == size_type( 3 ) );
+    EXPECT( v.stride() == 4 );
+    EXPECT( v[0] == 0 );
+    EXPECT( v[1] == 4 );
+    EXPECT( v[2] == 8 );
+#else
+    EXPECT( !!"strided_span<> is not available (span_FEATURE_STRIDED_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "strided_span<>: Allows to create a sub span via first(), last() and subspan()" )
+{
+#if span_NONSTD_AND( span_FEATURE( STRIDED_SPAN ) )
+    int arr[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, };
+
+    strided_span<int> v = stride( span<int>( arr ), 2 );    // 0, 2, 4, 6, 8
+
+    strided_span<int, 2> f2 = v.first<2>();
+    strided_span<int, 2> l2 = v.last<2>();
+    strided_span<int, 2> s2 = v.subspan<1, 2>();
+    strided_span<int>    f  = v.first( 3 );
+    strided_span<int>    l  = v.last( 3 );
+    strided_span<int>    s  = v.subspan( 2 );
+
+    EXPECT( f2.size() == size_type( 2 ) ); EXPECT( f2[0] == 0 ); EXPECT( f2[1] == 2 );
+    EXPECT( l2.size() == size_type( 2 ) ); EXPECT( l2[0] == 6 ); EXPECT( l2[1] == 8 );
+    EXPECT( s2.size() == size_type( 2 ) ); EXPECT( s2[0] == 2 ); EXPECT( s2[1] == 4 );
+    EXPECT( f .size() == size_type( 3 ) ); EXPECT( f [0] == 0 ); EXPECT( f [2] == 4 );
+    EXPECT( l .size() == size_type( 3 ) ); EXPECT( l [0] == 4 ); EXPECT( l [2] == 8 );
+    EXPECT( s .size() == size_type( 3 ) ); EXPECT( s [0] == 4 ); EXPECT( s [2] == 8 );
+    EXPECT( s2.stride() == 2 );
+#else
+    EXPECT( !!"strided_span<> is not available (span_FEATURE_STRIDED_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "strided_span<>: Allows to create an empty sub span at the end via last() and subspan()" )
+{
+#if span_NONSTD_AND( span_FEATURE( STRIDED_SPAN ) )
+    int arr[] = { 0, 1, 2, 3, 4, 5, 6, };
+
+    strided_span<int> v = stride( span<int>( arr ), 3 );    // 0, 3, 6
+
+    strided_span<int, 0> l0 = v.last<0>();
+    strided_span<int>    l  = v.last( 0 );
+    strided_span<int>    s  = v.subspan( v.size() );
+
+    EXPECT( l0.empty() ); EXPECT( l0.data() == v.data() );
+    EXPECT( l .empty() ); EXPECT( l .data() == v.data() );
+    EXPECT( s .empty() ); EXPECT( s .data() == v.data() );
+    EXPECT( s.begin() - s.end() == 0 );
+#else
+    EXPECT( !!"strided_span<> is not available (span_FEATURE_STRIDED_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "strided_span<>: Allows random-access and reverse iteration" )
+{
+#if span_NONSTD_AND( span_FEATURE( STRIDED_SPAN ) )
+    int arr[] = { 0, 1, 2, 3, 4, 5, 6, };
+    int rev[] = { 6, 3, 0, };
+
+    strided_span<int> v = stride( span<int>( arr ), 3 );
+    strided_span<int>::iterator pos = v.begin();
+
+    EXPECT( v.end() - v.begin() == 3 );
+    EXPECT( *( pos + 2 ) == 6 );
+    EXPECT( pos[1] == 3 );
+    EXPECT( (( pos += 2 ) == v.end() - 1) );
+    EXPECT( *--pos == 3 );
+    EXPECT( (v.begin() < v.end()) );
+    EXPECT( std::equal( v.rbegin(), v.rend(), &rev[0] ) );
+#else
+    EXPECT( !!"strided_span<> is not available (span_FEATURE_STRIDED_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "aligned_span<> [span_FEATURE_ALIGNED_SPAN=1]" )
+{
+    EXPECT( !!"(avoid warning)" );  // suppress: unused parameter 'lest_env' [-Wunused-parameter]
+}
+
+#if span_NONSTD_AND( span_FEATURE( ALIGNED_SPAN ) )
+
+// first element of arr at a 16-byte boundary; arr must provide 3 spare elements:
+
+static float * align16( float * arr )
+{
+    while ( reinterpret_cast< std::size_t >( arr ) % 16 != 0 )
+        ++arr;
+    return arr;
+}
+
+#endif
+
+CASE( "aligned_span<>: Allows to construct from an aligned pointer and a size" )
+{
+#if span_NONSTD_AND( span_FEATURE( ALIGNED_SPAN ) )
+    float arr[ 8 + 3 ] = { 0 };
+    float * ptr = align16( arr );
+
+    aligned_span<float, 16> v( ptr, 8 );
+
+    EXPECT( v.data() == ptr );
+    EXPECT( v.size() == 8u );
+    EXPECT( v.size_bytes() == 8 * sizeof( float ) );
+    EXPECT( v.alignment == 16 );
+#else
+    EXPECT( !!"aligned_span<> is not available (span_FEATURE_ALIGNED_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "aligned_span<>: Terminates construction from a misaligned pointer" )
+{
+#if span_NONSTD_AND( span_FEATURE( ALIGNED_SPAN ) )
+    struct F { static void blow() { float arr[ 8 + 3 ] = { 0 }; aligned_span<float, 16> v( align16( arr ) + 1, 4 ); } };
+
+    EXPECT_THROWS( F::blow() );
+#else
+    EXPECT( !!"aligned_span<> is not available (span_FEATURE_ALIGNED_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "aligned_span<>: Allows to create from a span via make_aligned_span<>()" )
+{
+#if span_NONSTD_AND( span_FEATURE( ALIGNED_SPAN ) )
+    float arr[ 8 + 3 ] = { 0 };
+    span<float> s( align16( arr ), 8 );
+
+    aligned_span<float, 16> v = make_aligned_span<16>( s );
+
+    EXPECT( v.data() == s.data() );
+    EXPECT( v.size() == s.size() );
+    EXPECT_THROWS( make_aligned_span<16>( s.subspan( 1 ) ) );
+#else
+    EXPECT( !!"aligned_span<> is not available (span_FEATURE_ALIGNED_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "aligned_span<>: Allows to convert to a span and to an aligned_span of weaker alignment" )
+{
+#if span_NONSTD_AND( span_FEATURE( ALIGNED_SPAN ) )
+    float arr[ 8 + 3 ] = { 0 };
+    float * ptr = align16( arr );
+
+    aligned_span<float, 16> v( ptr, 8 );
+    aligned_span<float const, 8> w( v );
+    span<float> s = v;
+
+    EXPECT( w.data() == ptr );
+    EXPECT( w.size() == 8u );
+    EXPECT( s.data() == ptr );
+    EXPECT( s.size() == 8u );
+    EXPECT( v.as_span().data() == ptr );
+#else
+    EXPECT( !!"aligned_span<> is not available (span_FEATURE_ALIGNED_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "aligned_span<>: Allows to access elements and to iterate" )
+{
+#if span_NONSTD_AND( span_FEATURE( ALIGNED_SPAN ) )
+    float arr[ 4 + 3 ] = { 0 };
+    float * ptr = align16( arr );
+    ptr[0] = 1; ptr[1] = 2; ptr[2] = 3; ptr[3] = 4;
+
+    aligned_span<float, 16> v( ptr, 4 );
+
+    float sum = 0;
+    for ( aligned_span<float, 16>::iterator pos = v.begin(); pos != v.end(); ++pos )
+        sum += *pos;
+
+    EXPECT( v[2] == 3 );
+    EXPECT( v.front() == 1 );
+    EXPECT( v.back() == 4 );
+    EXPECT( *v.rbegin() == 4 );
+    EXPECT( sum == 10 );
+#else
+    EXPECT( !!"aligned_span<> is not available (span_FEATURE_ALIGNED_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "aligned_span<>: Allows to create sub spans, only first() retains the alignment" )
+{
+#if span_NONSTD_AND( span_FEATURE( ALIGNED_SPAN ) )
+    float arr[ 8 + 3 ] = { 0 };
+    float * ptr = align16( arr );
+
+    aligned_span<float, 16> v( ptr, 8 );
+
+    aligned_span<float, 16>    f = v.first( 4 );
+    aligned_span<float, 16, 4> g = v.first<4>();
+    span<float> l = v.last( 3 );
+    span<float> m = v.subspan( 1, 2 );
+
+    EXPECT( f.data() == ptr     ); EXPECT( f.size() == 4u );
+    EXPECT( g.data() == ptr     ); EXPECT( g.size() == 4u );
+    EXPECT( l.data() == ptr + 5 ); EXPECT( l.size() == 3u );
+    EXPECT( m.data() == ptr + 1 ); EXPECT( m.size() == 2u );
+    EXPECT_THROWS( v.first( 9 ) );
+#else
+    EXPECT( !!"aligned_span<> is not available (span_FEATURE_ALIGNED_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "noalias_span<>, overlaps() [span_FEATURE_NOALIAS_SPAN=1]" )
+{
+    EXPECT( !!"(avoid warning)" );  // suppress: unused parameter 'lest_env' [-Wunused-parameter]
+}
+
+CASE( "overlaps(): Allows to determine if two spans share elements" )
+{
+#if span_NONSTD_AND( span_FEATURE( NOALIAS_SPAN ) )
+    int arr[] = { 1, 2, 3, 4, 5, 6, };
+    span<int> v( arr );
+
+    EXPECT(     overlaps( v, v ) );
+    EXPECT(     overlaps( v.first( 3 ), v.subspan( 2, 2 ) ) );
+    EXPECT(     overlaps( v.subspan( 2, 2 ), v.first( 3 ) ) );
+    EXPECT( ! overlaps( v.first( 3 ), v.last( 3 ) ) );
+    EXPECT( ! overlaps( v.last( 3 ), v.first( 3 ) ) );
+    EXPECT( ! overlaps( v.first( 0 ), v ) );
+    EXPECT( ! overlaps( v, span<int>() ) );
+#else
+    EXPECT( !!"overlaps() is not available (span_FEATURE_NOALIAS_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "overlaps(): Allows to compare spans of different element types bytewise" )
+{
+#if span_NONSTD_AND( span_FEATURE( NOALIAS_SPAN ) )
+    int arr[] = { 1, 2, 3, 4, };
+    span<int> v( arr );
+    span<unsigned char const> b( reinterpret_cast<unsigned char const *>( arr ), sizeof( arr ) );
+
+    EXPECT(   overlaps( v.last( 1 ), b.last( 1 ) ) );
+    EXPECT( ! overlaps( v.first( 1 ), b.last( sizeof( int ) ) ) );
+    EXPECT(   overlaps( v.first( 1 ), b.first( sizeof( int ) ) ) );
+#else
+    EXPECT( !!"overlaps() is not available (span_FEATURE_NOALIAS_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "noalias_span<>: Allows to create from a span and to access elements" )
+{
+#if span_NONSTD_AND( span_FEATURE( NOALIAS_SPAN ) )
+    int arr[] = { 1, 2, 3, };
+    span<int> v( arr );
+
+    noalias_span<int> w = make_noalias_span( v );
+
+    int sum = 0;
+    for ( noalias_span<int>::iterator pos = w.begin(); pos != w.end(); ++pos )
+        sum += *pos;
+
+    EXPECT( w.data() == v.data() );
+    EXPECT( w.size() == v.size() );
+    EXPECT( w.size_bytes() == v.size_bytes() );
+    EXPECT( w[1] == 2 );
+    EXPECT( *w.rbegin() == 3 );
+    EXPECT( sum == 6 );
+    EXPECT( w.as_span().data() == v.data() );
+    EXPECT_THROWS( w[3] );
+#else
+    EXPECT( !!"noalias_span<> is not available (span_FEATURE_NOALIAS_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "noalias_span<>: Allows to assert that two views are disjoint via overlaps()" )
+{
+#if span_NONSTD_AND( span_FEATURE( NOALIAS_SPAN ) )
+    int arr[] = { 1, 2, 3, 4, };
+    span<int> v( arr );
+
+    noalias_span<int>       dst = make_noalias_span( v.first( 2 ) );
+    noalias_span<int const> src = make_noalias_span( span<int const>( v.last( 2 ) ) );
+
+    EXPECT( ! overlaps( dst, src ) );
+    EXPECT(   overlaps( dst, make_noalias_span( v ) ) );
+#else
+    EXPECT( !!"noalias_span<> is not available (span_FEATURE_NOALIAS_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "bit_span<> [span_FEATURE_BIT_SPAN=1]" )
+{
+    EXPECT( !!"(avoid warning)" );  // suppress: unused parameter 'lest_env' [-Wunused-parameter]
+}
+
+CASE( "bit_span<>: Allows to view the bits of a span of words" )
+{
+#if span_NONSTD_AND( span_FEATURE( BIT_SPAN ) )
+    unsigned char arr[] = { 0x05, 0x80, };
+    span<unsigned char> words( arr );
+
+    bit_span<unsigned char> v( words );
+
+    EXPECT( v.size() == 16u );
+    EXPECT( v[0] );
+    EXPECT( ! v[1] );
+    EXPECT( v[2] );
+    EXPECT( v.test( 15 ) );
+    EXPECT( ! v.test( 14 ) );
+#else
+    EXPECT( !!"bit_span<> is not available (span_FEATURE_BIT_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "bit_span<>: Allows to view a range of bits at a bit offset" )
+{
+#if span_NONSTD_AND( span_FEATURE( BIT_SPAN ) )
+    unsigned char arr[] = { 0x00, 0x00, 0xF0, 0x01, };
+    span<unsigned char> words( arr );
+
+    bit_span<unsigned char> v( words, 20, 6 );
+
+    EXPECT( v.size() == 6u );
+    EXPECT( v.offset() == 4u );
+    EXPECT( v.words().data() == &arr[2] );
+    EXPECT( v.count() == 5u );
+    EXPECT( v.subspan( 1, 4 ).all() );
+    EXPECT( v.first( 5 ).count() == 5u );
+    EXPECT( v.last( 2 ).count() == 1u );
+#else
+    EXPECT( !!"bit_span<> is not available (span_FEATURE_BIT_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "bit_span<>: Terminates access outside the bit span" )
+{
+#if span_NONSTD_AND( span_FEATURE( BIT_SPAN ) )
+    struct F {
+        static void blow_index()  { unsigned char arr[] = { 0, 0, }; bit_span<unsigned char> v( span<unsigned char>( arr ), 3, 8 ); (void) v[8]; }
+        static void blow_create() { unsigned char arr[] = { 0, 0, }; bit_span<unsigned char> v( span<unsigned char>( arr ), 9, 8 ); }
+    };
+
+    EXPECT_THROWS( F::blow_index()  );
+    EXPECT_THROWS( F::blow_create() );
+#else
+    EXPECT( !!"bit_span<> is not available (span_FEATURE_BIT_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "bit_span<>: Allows to modify bits via a proxy reference and set(), reset(), flip()" )
+{
+#if span_NONSTD_AND( span_FEATURE( BIT_SPAN ) )
+    unsigned char arr[] = { 0x00, 0x00, };
+    bit_span<unsigned char> v( span<unsigned char>( arr ), 4, 8 );
+
+    v[0] = true;
+    v[7] = v[0];
+    v.set( 3 );
+    v.flip( 4 );
+    v.set( 5 ); v.reset( 5 );
+    v[3].flip();
+
+    EXPECT( arr[0] == 0x10 );
+    EXPECT( arr[1] == 0x09 );
+    EXPECT( ~v[1] );
+    EXPECT( v.count() == 3u );
+#else
+    EXPECT( !!"bit_span<> is not available (span_FEATURE_BIT_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "bit_span<>: Allows to count bits and to test for any, all and none set" )
+{
+#if span_NONSTD_AND( span_FEATURE( BIT_SPAN ) )
+    unsigned arr[] = { 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000001u, };
+    span<unsigned> words( arr );
+
+    EXPECT( bit_span<unsigned>( words ).count() == 65u );
+    EXPECT( bit_span<unsigned>( words, 3, 62 ).all() );
+    EXPECT( bit_span<unsigned>( words, 2, 63 ).all() );
+    EXPECT( ! bit_span<unsigned>( words, 2, 64 ).all() );
+    EXPECT( bit_span<unsigned>( words, 65, 31 ).none() );
+    EXPECT( bit_span<unsigned>( words, 60, 36 ).any() );
+    EXPECT( bit_span<unsigned>().none() );
+    EXPECT( bit_span<unsigned>().all() );
+#else
+    EXPECT( !!"bit_span<> is not available (span_FEATURE_BIT_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "bit_span<>: Allows to find set bits via find_first() and find_next()" )
+{
+#if span_NONSTD_AND( span_FEATURE( BIT_SPAN ) )
+    unsigned char arr[] = { 0x01, 0x00, 0x00, 0x84, 0x00, };
+    bit_span<unsigned char> v( span<unsigned char>( arr ), 1, 38 );
+
+    size_t found[4] = { 0, 0, 0, 0, }; size_t n = 0;
+    for ( size_t pos = v.find_first(); pos != v.size() && n < 4; pos = v.find_next( pos ) )
+        found[ n++ ] = pos;
+
+    EXPECT( n == 2u );
+    EXPECT( found[0] == 25u );
+    EXPECT( found[1] == 30u );
+    EXPECT( v.find_next( 30 ) == v.size() );
+    EXPECT( v.find_next( v.size() ) == v.size() );
+    EXPECT( bit_span<unsigned char>( span<unsigned char>( arr ), 1, 24 ).find_first() == 24u );
+#else
+    EXPECT( !!"bit_span<> is not available (span_FEATURE_BIT_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "bit_span<>: Allows to get and set a word's worth of bits at any position" )
+{
+#if span_NONSTD_AND( span_FEATURE( BIT_SPAN ) )
+    unsigned char arr[] = { 0x00, 0x00, 0x00, };
+    span<unsigned char> words( arr );
+    bit_span<unsigned char> v( words );
+
+    v.set_bits( 5, 8, 0xA5 );
+
+    EXPECT( arr[0] == 0xA0 );
+    EXPECT( arr[1] == 0x14 );
+    EXPECT( v.get_bits( 5, 8 ) == 0xA5 );
+    EXPECT( v.get_bits( 7, 3 ) == 0x01 );
+#else
+    EXPECT( !!"bit_span<> is not available (span_FEATURE_BIT_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "bit_span<>: Allows to combine bit spans via bitwise_and(), bitwise_or(), bitwise_xor()" )
+{
+#if span_NONSTD_AND( span_FEATURE( BIT_SPAN ) )
+    unsigned char a[] = { 0xFF, 0x0F, 0x00, };
+    unsigned char b[] = { 0xF0, 0xFF, 0x00, };
+    unsigned char c[] = { 0xF0, 0xFF, 0x00, };
+    unsigned char d[] = { 0xF0, 0xFF, 0x00, };
+    unsigned char e[] = { 0x33, 0x33, 0xF3, };
+
+    bit_span<unsigned char const> src( span<unsigned char const>( a ), 0, 16 );
+
+    bitwise_and( bit_span<unsigned char>( span<unsigned char>( b ), 0, 16 ), src );
+    bitwise_or ( bit_span<unsigned char>( span<unsigned char>( c ), 4, 16 ), src );
+    bitwise_xor( bit_span<unsigned char>( span<unsigned char>( d ), 0, 16 ), src );
+    bitwise_and( bit_span<unsigned char>( span<unsigned char>( e ), 2, 20 ), bit_span<unsigned char>( span<unsigned char>( b ), 0, 20 ) );
+
+    EXPECT( b[0] == 0xF0 ); EXPECT( b[1] == 0x0F );
+    EXPECT( c[0] == 0xF0 ); EXPECT( c[1] == 0xFF ); EXPECT( c[2] == 0x00 );
+    EXPECT( d[0] == 0x0F ); EXPECT( d[1] == 0xF0 );
+    EXPECT( e[0] == 0x03 ); EXPECT( e[1] == 0x33 ); EXPECT( e[2] == 0xC0 );
+#else
+    EXPECT( !!"bit_span<> is not available (span_FEATURE_BIT_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "bit_span<>: Allows to convert to a bit span of const words, with bool as reference" )
+{
+#if span_NONSTD_AND( span_FEATURE( BIT_SPAN ) )
+    unsigned char arr[] = { 0x02, };
+    span<unsigned char> words( arr );
+    bit_span<unsigned char> v( words );
+    bit_span<unsigned char const> w( v );
+
+    bool bit = w[1];
+
+    EXPECT( bit );
+    EXPECT( w.size() == v.size() );
+    EXPECT( w.count() == 1u );
+#else
+    EXPECT( !!"bit_span<> is not available (span_FEATURE_BIT_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "ring_view<> [span_FEATURE_RING_VIEW=1]" )
+{
+    EXPECT( !!"(avoid warning)" );  // suppress: unused parameter 'lest_env' [-Wunused-parameter]
+}
+
+CASE( "ring_view<>: Allows to view a range of a buffer that does not wrap around as a single region" )
+{
+#if span_NONSTD_AND( span_FEATURE( RING_VIEW ) )
+    int arr[] = { 0, 1, 2, 3, 4, 5, };
+    span<int> buf( arr );
+
+    ring_view<int> v( buf, 1, 3 );
+    ring_regions<int> r = v.regions();
+
+    EXPECT( v.size() == 3u );
+    EXPECT( v.capacity() == 6u );
+    EXPECT( v.position() == 1u );
+    EXPECT( r.first.data() == &arr[1] );
+    EXPECT( r.first.size() == 3u );
+    EXPECT( r.second.empty() );
+    EXPECT( r.size() == 3u );
+#else
+    EXPECT( !!"ring_view<> is not available (span_FEATURE_RING_VIEW=0, or using std::span)" );
+#endif
+}
+
+CASE( "ring_view<>: Allows to view a range of a buffer that wraps around as two regions" )
+{
+#if span_NONSTD_AND( span_FEATURE( RING_VIEW ) )
+    int arr[] = { 0, 1, 2, 3, 4, 5, };
+    span<int> buf( arr );
+
+    ring_view<int> v( buf, 10, 5 );
+    ring_regions<int> r = v.regions();
+
+    EXPECT( v.position() == 4u );
+    EXPECT( r.first.data()  == &arr[4] );
+    EXPECT( r.first.size()  == 2u );
+    EXPECT( r.second.data() == &arr[0] );
+    EXPECT( r.second.size() == 3u );
+    EXPECT( ring_view<int>( buf, 0, 6 ).regions().second.empty() );
+    EXPECT( ring_view<int>( buf, 3, 3 ).regions().second.empty() );
+#else
+    EXPECT( !!"ring_view<> is not available (span_FEATURE_RING_VIEW=0, or using std::span)" );
+#endif
+}
+
+CASE( "ring_view<>: Terminates construction with a size exceeding the capacity" )
+{
+#if span_NONSTD_AND( span_FEATURE( RING_VIEW ) )
+    struct F { static void blow() { int arr[] = { 1, 2, 3, }; ring_view<int> v( span<int>( arr ), 0, 4 ); } };
+
+    EXPECT_THROWS( F::blow() );
+#else
+    EXPECT( !!"ring_view<> is not available (span_FEATURE_RING_VIEW=0, or using std::span)" );
+#endif
+}
+
+CASE( "ring_view<>: Allows to access and iterate over elements across the wrap point" )
+{
+#if span_NONSTD_AND( span_FEATURE( RING_VIEW ) )
+    int arr[] = { 0, 1, 2, 3, 4, 5, };
+    span<int> buf( arr );
+
+    ring_view<int const> v( ring_view<int>( buf, 4, 4 ) );
+
+    int fwd[4] = { 0, }; int n = 0;
+    for ( ring_view<int const>::iterator pos = v.begin(); pos != v.end(); ++pos )
+        fwd[ n++ ] = *pos;
+
+    EXPECT( fwd[0] == 4 ); EXPECT( fwd[1] == 5 ); EXPECT( fwd[2] == 0 ); EXPECT( fwd[3] == 1 );
+    EXPECT( v[2] == 0 );
+    EXPECT( v.front() == 4 );
+    EXPECT( v.back()  == 1 );
+    EXPECT( *v.rbegin() == 1 );
+    EXPECT( v.end() - v.begin() == 4 );
+    EXPECT( v.begin()[3] == 1 );
+#else
+    EXPECT( !!"ring_view<> is not available (span_FEATURE_RING_VIEW=0, or using std::span)" );
+#endif
+}
+
+CASE( "ring_view<>: Allows to create sub views via first(), last(), subspan()" )
+{
+#if span_NONSTD_AND( span_FEATURE( RING_VIEW ) )
+    int arr[] = { 0, 1, 2, 3, 4, 5, };
+    span<int> buf( arr );
+
+    ring_view<int> v( buf, 3, 6 );
+
+    EXPECT( v.first( 3 ).front() == 3 );
+    EXPECT( v.first( 3 ).back()  == 5 );
+    EXPECT( v.last( 2 ).front()  == 1 );
+    EXPECT( v.last( 2 ).back()   == 2 );
+    EXPECT( v.subspan( 2, 2 ).front() == 5 );
+    EXPECT( v.subspan( 2, 2 ).back()  == 0 );
+    EXPECT( v.subspan( 4 ).size() == 2u );
+    EXPECT( v.subspan( 4 ).front() == 1 );
+#else
+    EXPECT( !!"ring_view<> is not available (span_FEATURE_RING_VIEW=0, or using std::span)" );
+#endif
+}
+
+CASE( "ring_view<>: Allows a producer and a consumer to copy in bulk via ring_writable() and ring_readable()" )
+{
+#if span_NONSTD_AND( span_FEATURE( RING_VIEW ) )
+    int arr[4] = { 0, };
+    span<int> buf( arr );
+    size_t read = 0, write = 0;
+
+    int const in[] = { 1, 2, 3, 4, 5, 6, 7, };
+    int out[7] = { 0, };
+
+    // write 3, read 2, write 3 (wraps), read 4 (wraps), write 1, read 1:
+
+    size_t const writes[] = { 3, 3, 1, };
+    size_t const reads[]  = { 2, 4, 1, };
+
+    for ( size_t step = 0; step < 3; ++step )
+    {
+        ring_regions<int> w = ring_writable( buf, read, write ).first( writes[step] ).regions();
+        std::copy( &in[write], &in[write] + w.first.size(), w.first.begin() );
+        std::copy( &in[write] + w.first.size(), &in[write] + w.size(), w.second.begin() );
+        write += w.size();
+
+        ring_regions<int> r = ring_readable( buf, read, write ).first( reads[step] ).regions();
+        std::copy( r.first.begin(), r.first.end(), &out[read] );
+        std::copy( r.second.begin(), r.second.end(), &out[read] + r.first.size() );
+        read += r.size();
+    }
+
+    EXPECT( read  == 7u );
+    EXPECT( write == 7u );
+    EXPECT( std::equal( in, in + 7, out ) );
+    EXPECT( ring_writable( buf, read, write ).size() == 4u );
+    EXPECT( ring_readable( buf, read, write ).empty() );
+#else
+    EXPECT( !!"ring_view<> is not available (span_FEATURE_RING_VIEW=0, or using std::span)" );
+#endif
+}
+
+CASE( "ring_view<>: Allows free-running counts that wrap around via ring_writable() and ring_readable()" )
+{
+#if span_NONSTD_AND( span_FEATURE( RING_VIEW ) )
+    int arr[4] = { 1, 2, 3, 4, };
+    span<int> buf( arr );
+
+    // 3 elements written, 1 read, the write count has wrapped around:
+
+    size_t const read  = size_t( -2 );
+    size_t const write = read + 3;
+
+    ring_view<int> r = ring_readable( buf, read, write );
+
+    EXPECT( r.size() == 3u );
+    EXPECT( r[0] == 3 );
+    EXPECT( r[2] == 1 );
+    EXPECT( ring_writable( buf, read, write ).size() == 1u );
+    EXPECT( ring_writable( buf, read, write )[0] == 2 );
+#else
+    EXPECT( !!"ring_view<> is not available (span_FEATURE_RING_VIEW=0, or using std::span)" );
+#endif
+}
+
+CASE( "ring_view<>: Terminates ring_readable() for a capacity that is not a power of two" )
+{
+#if span_NONSTD_AND( span_FEATURE( RING_VIEW ) )
+    struct F { static void blow() { int arr[] = { 1, 2, 3, }; (void) ring_readable( span<int>( arr ), 0, 1 ); } };
+
+    EXPECT_THROWS( F::blow() );
+#else
+    EXPECT( !!"ring_view<> is not available (span_FEATURE_RING_VIEW=0, or using std::span)" );
+#endif
+}
+
+CASE( "span_list<> [span_FEATURE_SPAN_LIST=1]" )
+{
+    EXPECT( !!"(avoid warning)" );  // suppress: unused parameter 'lest_env' [-Wunused-parameter]
+}
+
+CASE( "span_list<>: Allows to append pieces and to obtain the number of pieces and the total size" )
+{
+#if span_NONSTD_AND( span_FEATURE( SPAN_LIST ) )
+    typedef unsigned char const uchar;
+    uchar a[] = { 1, 2, 3, };
+    uchar b[] = { 4, 5, };
+    uchar c[] = { 6, 7, 8, 9, };
+
+    span_list<uchar, 2> list;
+
+    EXPECT( list.empty() );
+    EXPECT( list.total_size() == 0u );
+
+    list.push_back( span<uchar>( a ) );
+    list.push_back( span<uchar>( b ).first( 0 ) );
+    list.push_back( span<uchar>( b ) );
+    list.push_back( span<uchar>( c ) );
+
+    EXPECT( list.size() == 3u );
+    EXPECT( list.total_size() == 9u );
+    EXPECT(( list.front().data() == a ));
+    EXPECT(( list[1].data() == b ));
+    EXPECT( list[1].size() == 2u );
+    EXPECT(( list[2].data() == c ));
+    EXPECT( list[2].size() == 4u );
+
+    list.clear();
+
+    EXPECT( list.empty() );
+    EXPECT( list.total_size() == 0u );
+#else
+    EXPECT( !!"span_list<> is not available (span_FEATURE_SPAN_LIST=0, or using std::span)" );
+#endif
+}
+
+CASE( "span_list<>: Allows to locate an element by its offset via seek()" )
+{
+#if span_NONSTD_AND( span_FEATURE( SPAN_LIST ) )
+    typedef unsigned char const uchar;
+    uchar a[] = { 1, 2, 3, };
+    uchar b[] = { 4, 5, };
+
+    span_list<uchar> list;
+    list.push_back( span<uchar>( a ) );
+    list.push_back( span<uchar>( b ) );
+
+    span_list_position p0 = list.seek( 0 );
+    span_list_position p2 = list.seek( 2 );
+    span_list_position p3 = list.seek( 3 );
+    span_list_position p4 = list.seek( 4 );
+    span_list_position p5 = list.seek( 5 );
+
+    EXPECT( p0.piece == 0u ); EXPECT( p0.offset == 0u );
+    EXPECT( p2.piece == 0u ); EXPECT( p2.offset == 2u );
+    EXPECT( p3.piece == 1u ); EXPECT( p3.offset == 0u );
+    EXPECT( p4.piece == 1u ); EXPECT( p4.offset == 1u );
+    EXPECT( p5.piece == 2u ); EXPECT( p5.offset == 0u );
+#else
+    EXPECT( !!"span_list<> is not available (span_FEATURE_SPAN_LIST=0, or using std::span)" );
+#endif
+}
+
+CASE( "span_list<>: Allows to remove elements from the front via consume(), e.g. after a partial write" )
+{
+#if span_NONSTD_AND( span_FEATURE( SPAN_LIST ) )
+    typedef unsigned char const uchar;
+    uchar a[] = { 1, 2, 3, };
+    uchar b[] = { 4, 5, };
+    uchar c[] = { 6, 7, 8, 9, };
+
+    span_list<uchar, 2> list;
+    list.push_back( span<uchar>( a ) );
+    list.push_back( span<uchar>( b ) );
+    list.push_back( span<uchar>( c ) );
+
+    list.consume( 4 );
+
+    EXPECT( list.size() == 2u );
+    EXPECT( list.total_size() == 5u );
+    EXPECT(( list[0].data() == &b[1] ));
+    EXPECT( list[0].size() == 1u );
+    EXPECT(( list[1].data() == c ));
+
+    list.consume( 1 );
+
+    EXPECT( list.size() == 1u );
+    EXPECT(( list.front().data() == c ));
+
+    list.consume( 4 );
+
+    EXPECT( list.empty() );
+    EXPECT( list.total_size() == 0u );
+#else
+    EXPECT( !!"span_list<> is not available (span_FEATURE_SPAN_LIST=0, or using std::span)" );
+#endif
+}
+
+CASE( "span_list<>: Allows to reuse the storage of consumed pieces via push_back()" )
+{
+#if span_NONSTD_AND( span_FEATURE( SPAN_LIST ) )
+    typedef unsigned char const uchar;
+    uchar a[] = { 1, 2, 3, };
+    uchar b[] = { 4, 5, };
+    uchar c[] = { 6, 7, 8, 9, };
+
+    span_list<uchar, 2> list;
+    list.push_back( span<uchar>( a ) );
+    list.push_back( span<uchar>( b ) );
+    list.consume( 4 );
+    list.push_back( span<uchar>( c ) );
+
+    void const * const iov = list.iovecs().data();
+
+    EXPECT( list.size() == 2u );
+    EXPECT(( iov >= static_cast< void const * >( &list ) && iov < static_cast< void const * >( &list + 1 ) ));
+    EXPECT(( list[0].data() == &b[1] ));
+    EXPECT(( list[1].data() == c ));
+
+    list.push_back( span<uchar>( a ) );
+    list.consume( 5 );
+    list.push_back( span<uchar>( b ) );
+
+    EXPECT( list.size() == 2u );
+    EXPECT( list.total_size() == 5u );
+    EXPECT(( list[0].data() == a ));
+    EXPECT(( list[1].data() == b ));
+#else
+    EXPECT( !!"span_list<> is not available (span_FEATURE_SPAN_LIST=0, or using std::span)" );
+#endif
+}
+
+CASE( "span_list<>: Terminates consume() beyond the total size" )
+{
+#if span_NONSTD_AND( span_FEATURE( SPAN_LIST ) )
+    struct F { static void blow() { unsigned char const a[] = { 1, 2, 3, }; span_list<unsigned char const> list; list.push_back( span<unsigned char const>( a ) ); list.consume( 4 ); } };
+
+    EXPECT_THROWS( F::blow() );
+#else
+    EXPECT( !!"span_list<> is not available (span_FEATURE_SPAN_LIST=0, or using std::span)" );
+#endif
+}
+
+CASE( "span_list<>: Allows to view the pieces as iovec without copying via iovecs()" )
+{
+#if span_NONSTD_AND( span_FEATURE( SPAN_LIST ) )
+    typedef unsigned char const uchar;
+    uchar a[] = { 1, 2, 3, };
+    uchar b[] = { 4, 5, };
+
+    span_list<uchar, 1> list;
+    list.push_back( span<uchar>( a ) );
+    list.push_back( span<uchar>( b ) );
+    list.consume( 1 );
+
+    span< span_list<uchar, 1>::iovec_type const > iov = list.iovecs();
+
+    EXPECT( iov.size() == 2u );
+    EXPECT(( iov[0].iov_base == &a[1] ));
+    EXPECT( iov[0].iov_len  == 2u );
+    EXPECT(( iov[1].iov_base == b ));
+    EXPECT( iov[1].iov_len  == 2u );
+#else
+    EXPECT( !!"span_list<> is not available (span_FEATURE_SPAN_LIST=0, or using std::span)" );
+#endif
+}
+
+CASE( "mapped_file [span_FEATURE_MAPPED_FILE=1]" )
+{
+    EXPECT( !!"(avoid warning)" );  // suppress: unused parameter 'lest_env' [-Wunused-parameter]
+}
+
+#if span_NONSTD_AND( span_HAVE( MAPPED_FILE ) )
+
+// a temporary file with the given contents; returns its path, or an empty path on failure:
+
+static std::string make_temp_file( unsigned char const * data, size_t size )
+{
+    char path[] = "/tmp/span-lite-XXXXXX";
+    int const fd = ::mkstemp( path );
+
+    if ( fd < 0 )
+        return std::string();
+
+    bool const written = ::write( fd, data, size ) == static_cast< ssize_t >( size );
+    ::close( fd );
+
+    return written ? std::string( path ) : std::string();
+}
+
+#endif
+
+CASE( "mapped_file: Allows to view a file as a span of read-only bytes" )
+{
+#if span_NONSTD_AND( span_HAVE( MAPPED_FILE ) )
+    unsigned char const arr[] = { 1, 2, 3, 4, 5, 6, 7, 8, };
+    std::string const path = make_temp_file( arr, sizeof arr );
+
+    mapped_file file( path.c_str() );
+
+    EXPECT( file.is_open() );
+    EXPECT( file.mode() == mapped_file::read_only );
+    EXPECT( file.size() == 8u );
+    EXPECT( file.bytes().size() == 8u );
+    EXPECT( std::equal( arr, arr + 8, file.as_span<unsigned char>().begin() ) );
+
+    file.close();
+
+    EXPECT( ! file.is_open() );
+    EXPECT( file.bytes().empty() );
+
+    ::unlink( path.c_str() );
+#else
+    EXPECT( !!"mapped_file is not available (span_FEATURE_MAPPED_FILE=0, no POSIX, or using std::span)" );
+#endif
+}
+
+CASE( "mapped_file: Allows to change a file via a span of writable bytes" )
+{
+#if span_NONSTD_AND( span_HAVE( MAPPED_FILE ) )
+    unsigned char const arr[] = { 1, 2, 3, 4, };
+    std::string const path = make_temp_file( arr, sizeof arr );
+    {
+        mapped_file file( path.c_str(), mapped_file::read_write );
+        span<unsigned char> v = file.as_writable_span<unsigned char>();
+
+        EXPECT( file.is_open() );
+        EXPECT( file.writable_bytes().size() == 4u );
+
+        v[0] = 42;
+
+        EXPECT( file.flush() );
+    }
+    mapped_file file( path.c_str() );
+
+    EXPECT( file.as_span<unsigned char>()[0] == 42 );
+    EXPECT( file.as_span<unsigned char>()[1] == 2 );
+
+    ::unlink( path.c_str() );
+#else
+    EXPECT( !!"mapped_file is not available (span_FEATURE_MAPPED_FILE=0, no POSIX, or using std::span)" );
+#endif
+}
+
+CASE( "mapped_file: Allows to view a file as a span of elements of type U via as_span<U>()" )
+{
+#if span_NONSTD_AND( span_HAVE( MAPPED_FILE ) )
+    unsigned short const arr[] = { 1, 2, 3, 0xffff, };
+    std::string const path = make_temp_file( reinterpret_cast< unsigned char const * >( arr ), sizeof arr );
+
+    mapped_file file( path.c_str() );
+    span<unsigned short const> v = file.as_span<unsigned short>();
+
+    EXPECT( v.size() == 4u );
+    EXPECT( std::equal( arr, arr + 4, v.begin() ) );
+
+    ::unlink( path.c_str() );
+#else
+    EXPECT( !!"mapped_file is not available (span_FEATURE_MAPPED_FILE=0, no POSIX, or using std::span)" );
+#endif
+}
+
+CASE( "mapped_file: Terminates as_span<U>() for a size that is not a multiple of sizeof(U)" )
+{
+#if span_NONSTD_AND( span_HAVE( MAPPED_FILE ) )
+    unsigned char const arr[] = { 1, 2, 3, };
+    std::string const path = make_temp_file( arr, sizeof arr );
+
+    mapped_file file( path.c_str() );
+    ::unlink( path.c_str() );
+
+    struct F { static void blow( mapped_file & file ) { file.as_span<unsigned short>(); } };
+
+    EXPECT_THROWS( F::blow( file ) );
+#else
+    EXPECT( !!"mapped_file is not available (span_FEATURE_MAPPED_FILE=0, no POSIX, or using std::span)" );
+#endif
+}
+
+CASE( "mapped_file: Terminates writable_bytes() for a read-only mapping" )
+{
+#if span_NONSTD_AND( span_HAVE( MAPPED_FILE ) )
+    unsigned char const arr[] = { 1, 2, 3, };
+    std::string const path = make_temp_file( arr, sizeof arr );
+
+    mapped_file file( path.c_str() );
+    ::unlink( path.c_str() );
+
+    struct F { static void blow( mapped_file & file ) { file.writable_bytes(); } };
+
+    EXPECT_THROWS( F::blow( file ) );
+#else
+    EXPECT( !!"mapped_file is not available (span_FEATURE_MAPPED_FILE=0, no POSIX, or using std::span)" );
+#endif
+}
+
+CASE( "mapped_file: Reports failure to open via open() and is_open()" )
+{
+#if span_NONSTD_AND( span_HAVE( MAPPED_FILE ) )
+    mapped_file file;
+
+    EXPECT( ! file.open( "/nonexistent/span-lite" ) );
+    EXPECT( errno == ENOENT );
+    EXPECT( ! file.is_open() );
+    EXPECT( ! mapped_file( "/nonexistent/span-lite" ).is_open() );
+#else
+    EXPECT( !!"mapped_file is not available (span_FEATURE_MAPPED_FILE=0, no POSIX, or using std::span)" );
+#endif
+}
+
+CASE( "mapped_file: Allows to open an empty file" )
+{
+#if span_NONSTD_AND( span_HAVE( MAPPED_FILE ) )
+    std::string const path = make_temp_file( span_nullptr, 0 );
+
+    mapped_file file( path.c_str() );
+
+    EXPECT( file.is_open() );
+    EXPECT( file.empty() );
+    EXPECT( file.as_span<int>().empty() );
+    EXPECT( file.advise( mapped_file::sequential ) );
+
+    ::unlink( path.c_str() );
+#else
+    EXPECT( !!"mapped_file is not available (span_FEATURE_MAPPED_FILE=0, no POSIX, or using std::span)" );
+#endif
+}
+
+CASE( "mapped_file: Allows to give access hints via advise()" )
+{
+#if span_NONSTD_AND( span_HAVE( MAPPED_FILE ) )
+    std::vector<unsigned char> vec( 3 * 4096u + 7, 42 );
+    std::string const path = make_temp_file( &vec[0], vec.size() );
+
+    mapped_file file( path.c_str() );
+
+    EXPECT( file.advise( mapped_file::sequential ) );
+    EXPECT( file.advise( mapped_file::willneed, 4096u + 3, 100 ) );
+    EXPECT( file.advise( mapped_file::random, vec.size() - 1, 1 ) );
+    EXPECT( file.advise( mapped_file::normal ) );
+
+    file.advise( mapped_file::hugepage );  // support varies
+
+    ::unlink( path.c_str() );
+#else
+    EXPECT( !!"mapped_file is not available (span_FEATURE_MAPPED_FILE=0, no POSIX, or using std::span)" );
+#endif
+}
+
+CASE( "mapped_file: Allows to move-construct and to swap (C++11)" )
+{
+#if span_NONSTD_AND( span_HAVE( MAPPED_FILE ) ) && span_CPP11_OR_GREATER
+    unsigned char const arr[] = { 1, 2, 3, };
+    std::string const path = make_temp_file( arr, sizeof arr );
+
+    mapped_file a( path.c_str() );
+    mapped_file b( std::move( a ) );
+
+    EXPECT( ! a.is_open() );
+    EXPECT( b.is_open() );
+    EXPECT( b.size() == 3u );
+
+    a.swap( b );
+
+    EXPECT( a.size() == 3u );
+    EXPECT( b.empty() );
+
+    ::unlink( path.c_str() );
+#else
+    EXPECT( !!"mapped_file is not available (span_FEATURE_MAPPED_FILE=0, no POSIX, no C++11, or using std::span)" );
+#endif
+}
+
+CASE( "byte_reader [span_FEATURE_BYTE_READER=1]" )
+{
+    EXPECT( !!"(avoid warning)" );  // suppress: unused parameter 'lest_env' [-Wunused-parameter]
+}
+
+CASE( "byte_reader: Allows to read little- and big-endian integers" )
+{
+#if span_NONSTD_AND( span_FEATURE( BYTE_READER ) )
+    unsigned char const arr[] = { 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x03, 0x04, 0x01, 0x02, 0x03, 0x04, };
+    span<unsigned char const> bytes( arr );
+
+    byte_reader reader( bytes );
+
+    EXPECT( reader.size() == 12u );
+    EXPECT( reader.read<uint16_le>() == 0x0201u );
+    EXPECT( reader.read<uint16_be>() == 0x0102u );
+    EXPECT( reader.read<uint32_le>() == 0x04030201u );
+    EXPECT( reader.read<uint32_be>() == 0x01020304u );
+    EXPECT( reader.position() == 12u );
+    EXPECT( reader.empty() );
+#else
+    EXPECT( !!"byte_reader is not available (span_FEATURE_BYTE_READER=0, or using std::span)" );
+#endif
+}
+
+CASE( "byte_reader: Allows to read 64-bit little- and big-endian integers (C++11)" )
+{
+#if span_NONSTD_AND( span_FEATURE( BYTE_READER ) ) && span_CPP11_120
+    unsigned char const arr[] = { 1, 2, 3, 4, 5, 6, 7, 8, 1, 2, 3, 4, 5, 6, 7, 8, };
+    span<unsigned char const> bytes( arr );
+
+    byte_reader reader( bytes );
+
+    EXPECT( reader.read<uint64_le>() == 0x0807060504030201u );
+    EXPECT( reader.read<uint64_be>() == 0x0102030405060708u );
+#else
+    EXPECT( !!"byte_reader is not available (span_FEATURE_BYTE_READER=0, no C++11, or using std::span)" );
+#endif
+}
+
+CASE( "byte_reader: Allows to peek at a value without advancing" )
+{
+#if span_NONSTD_AND( span_FEATURE( BYTE_READER ) )
+    unsigned char const arr[] = { 0x12, 0x34, };
+    span<unsigned char const> bytes( arr );
+
+    byte_reader reader( bytes );
+
+    EXPECT( reader.peek<uint16_be>() == 0x1234u );
+    EXPECT( reader.position() == 0u );
+#else
+    EXPECT( !!"byte_reader is not available (span_FEATURE_BYTE_READER=0, or using std::span)" );
+#endif
+}
+
+CASE( "byte_reader: Allows to obtain and to skip bytes without copying via read_span() and skip()" )
+{
+#if span_NONSTD_AND( span_FEATURE( BYTE_READER ) )
+    unsigned char const arr[] = { 3, 'a', 'b', 'c', 0, 0, 7, };
+    span<unsigned char const> bytes( arr );
+
+    byte_reader reader( bytes );
+
+    size_t const count = reader.read_span( 1 ).size();
+    span<byte_reader::byte_type const> name = reader.read_span( arr[0] );
+
+    reader.skip( 2 );
+
+    EXPECT( count == 1u );
+    EXPECT( name.size() == 3u );
+    EXPECT( static_cast<void const *>( name.data() ) == &arr[1] );
+    EXPECT( reader.remaining().size() == 1u );
+    EXPECT( static_cast<void const *>( reader.remaining().data() ) == &arr[6] );
+#else
+    EXPECT( !!"byte_reader is not available (span_FEATURE_BYTE_READER=0, or using std::span)" );
+#endif
+}
+
+CASE( "byte_reader: Allows to read a varint" )
+{
+#if span_NONSTD_AND( span_FEATURE( BYTE_READER ) )
+    unsigned char const arr[] = { 0x05, 0xac, 0x02, 0xff, 0xff, 0xff, 0xff, 0x0f, };
+    span<unsigned char const> bytes( arr );
+
+    byte_reader reader( bytes );
+    byte_reader::varint_type a = 0, b = 0, c = 0;
+
+    EXPECT( reader.read_varint( a ) );
+    EXPECT( reader.read_varint( b ) );
+    EXPECT( reader.read_varint( c ) );
+    EXPECT( a == 5u );
+    EXPECT( b == 300u );
+    EXPECT( c == 0xffffffffu );
+    EXPECT( reader.empty() );
+#else
+    EXPECT( !!"byte_reader is not available (span_FEATURE_BYTE_READER=0, or using std::span)" );
+#endif
+}
+
+CASE( "byte_reader: Reports a truncated or too large varint via read_varint()" )
+{
+#if span_NONSTD_AND( span_FEATURE( BYTE_READER ) )
+    unsigned char const truncated[] = { 0x80, 0x80, };
+    unsigned char const overlong[]  = { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, };
+    span<unsigned char const> bytes1( truncated );
+    span<unsigned char const> bytes2( overlong );
+
+    byte_reader reader1( bytes1 );
+    byte_reader reader2( bytes2 );
+    byte_reader::varint_type value = 42;
+
+    EXPECT( ! reader1.read_varint( value ) );
+    EXPECT( ! reader2.read_varint( value ) );
+    EXPECT( reader1.position() == 0u );
+    EXPECT( reader2.position() == 0u );
+    EXPECT( value == 42u );
+#else
+    EXPECT( !!"byte_reader is not available (span_FEATURE_BYTE_READER=0, or using std::span)" );
+#endif
+}
+
+CASE( "byte_reader: Allows to check the size of a record before reading its fields via can_read()" )
+{
+#if span_NONSTD_AND( span_FEATURE( BYTE_READER ) )
+    unsigned char const arr[] = { 0x00, 0x01, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x02, };
+    span<unsigned char const> bytes( arr );
+
+    byte_reader reader( bytes );
+    unsigned long sum = 0;
+
+    while ( reader.can_read( 6 ) )
+    {
+        sum += reader.read<uint16_be>();
+        sum += reader.read<uint32_be>();
+    }
+
+    EXPECT( sum == 43u );
+    EXPECT( reader.size() == 2u );
+#else
+    EXPECT( !!"byte_reader is not available (span_FEATURE_BYTE_READER=0, or using std::span)" );
+#endif
+}
+
+CASE( "byte_reader: Allows to check a record once via can_read() and unchecked_byte_reader" )
+{
+#if span_NONSTD_AND( span_FEATURE( BYTE_READER ) )
+    unsigned char const arr[] = { 0x00, 0x01, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x02, };
+    span<unsigned char const> bytes( arr );
+
+    unchecked_byte_reader reader( bytes );
+    unsigned long sum = 0;
+
+    while ( reader.can_read( 6 ) )
+    {
+        sum += reader.read<uint16_be>();
+        sum += reader.read<uint32_be>();
+    }
+
+    EXPECT( sum == 43u );
+    EXPECT( reader.size() == 2u );
+#else
+    EXPECT( !!"byte_reader is not available (span_FEATURE_BYTE_READER=0, or using std::span)" );
+#endif
+}
+
+CASE( "byte_reader: Terminates reading beyond the end" )
+{
+#if span_NONSTD_AND( span_FEATURE( BYTE_READER ) )
+    struct F { static void blow() { unsigned char const arr[] = { 1, 2, 3, }; span<unsigned char const> bytes( arr ); byte_reader reader( bytes ); reader.read<uint32_le>(); } };
+
+    EXPECT_THROWS( F::blow() );
+#else
+    EXPECT( !!"byte_reader is not available (span_FEATURE_BYTE_READER=0, or using std::span)" );
+#endif
+}
+
+CASE( "byte_writer [span_FEATURE_BYTE_WRITER=1]" )
+{
+    EXPECT( !!"(avoid warning)" );  // suppress: unused parameter 'lest_env' [-Wunused-parameter]
+}
+
+CASE( "byte_writer: Allows to write little- and big-endian integers" )
+{
+#if span_NONSTD_AND( span_FEATURE( BYTE_WRITER ) )
+    unsigned char arr[12] = { 0, };
+    unsigned char const expected[] = { 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x03, 0x04, 0x01, 0x02, 0x03, 0x04, };
+    span<unsigned char> bytes( arr );
+
+    byte_writer writer( bytes );
+
+    writer.write<uint16_le>( 0x0201u );
+    writer.write<uint16_be>( 0x0102u );
+    writer.write<uint32_le>( 0x04030201u );
+    writer.write<uint32_be>( 0x01020304u );
+
+    EXPECT( writer.position() == 12u );
+    EXPECT( writer.empty() );
+    EXPECT( writer.written().size() == 12u );
+    EXPECT( std::equal( arr, arr + 12, expected ) );
+#else
+    EXPECT( !!"byte_writer is not available (span_FEATURE_BYTE_WRITER=0, or using std::span)" );
+#endif
+}
+
+CASE( "byte_writer: Allows to write 64-bit little- and big-endian integers (C++11)" )
+{
+#if span_NONSTD_AND( span_FEATURE( BYTE_WRITER ) ) && span_CPP11_120
+    unsigned char arr[16] = { 0, };
+    unsigned char const expected[] = { 1, 2, 3, 4, 5, 6, 7, 8, 1, 2, 3, 4, 5, 6, 7, 8, };
+    span<unsigned char> bytes( arr );
+
+    byte_writer writer( bytes );
+
+    writer.write<uint64_le>( 0x0807060504030201u );
+    writer.write<uint64_be>( 0x0102030405060708u );
+
+    EXPECT( std::equal( arr, arr + 16, expected ) );
+#else
+    EXPECT( !!"byte_writer is not available (span_FEATURE_BYTE_WRITER=0, no C++11, or using std::span)" );
+#endif
+}
+
+CASE( "byte_writer: Allows to write a copy of bytes via write_span()" )
+{
+#if span_NONSTD_AND( span_FEATURE( BYTE_WRITER ) )
+    unsigned char arr[4] = { 0, };
+    char const text[] = "abc";
+    span<unsigned char> bytes( arr );
+
+    byte_writer writer( bytes );
+
+    writer.write_span( span<char const>( text, 3 ) );
+    writer.write_span( span<char const>() );
+
+    EXPECT( writer.position() == 3u );
+    EXPECT( arr[0] == 'a' );
+    EXPECT( arr[2] == 'c' );
+#else
+    EXPECT( !!"byte_writer is not available (span_FEATURE_BYTE_WRITER=0, or using std::span)" );
+#endif
+}
+
+CASE( "byte_writer: Allows to reserve bytes to fill in later, e.g. a length prefix" )
+{
+#if span_NONSTD_AND( span_FEATURE( BYTE_WRITER ) )
+    unsigned char arr[8] = { 0, };
+    unsigned char const expected[] = { 0x00, 0x03, 'x', 'y', 'z', };
+    char const text[] = "xyz";
+    span<unsigned char> bytes( arr );
+
+    byte_writer writer( bytes );
+
+    span<byte_writer::byte_type> length = writer.reserve( 2 );
+    size_t const start = writer.position();
+    writer.write_span( span<char const>( text, 3 ) );
+
+    byte_writer( length ).write<uint16_be>( static_cast<unsigned short>( writer.position() - start ) );
+
+    EXPECT( writer.position() == 5u );
+    EXPECT( writer.remaining().size() == 3u );
+    EXPECT( std::equal( arr, arr + 5, expected ) );
+#else
+    EXPECT( !!"byte_writer is not available (span_FEATURE_BYTE_WRITER=0, or using std::span)" );
+#endif
+}
+
+CASE( "byte_writer: Allows to write a varint that byte_reader reads back" )
+{
+#if span_NONSTD_AND( span_FEATURE( BYTE_WRITER ) )
+    unsigned char arr[12] = { 0, };
+    unsigned char const expected[] = { 0x05, 0xac, 0x02, 0xff, 0xff, 0xff, 0xff, 0x0f, };
+    span<unsigned char> bytes( arr );
+
+    byte_writer writer( bytes );
+
+    writer.write_varint( 5u );
+    writer.write_varint( 300u );
+    writer.write_varint( 0xffffffffu );
+
+    EXPECT( byte_writer::varint_size( 0u ) == 1u );
+    EXPECT( byte_writer::varint_size( 300u ) == 2u );
+    EXPECT( writer.position() == 8u );
+    EXPECT( std::equal( arr, arr + 8, expected ) );
+#else
+    EXPECT( !!"byte_writer is not available (span_FEATURE_BYTE_WRITER=0, or using std::span)" );
+#endif
+}
+
+CASE( "byte_writer: Allows to check a batch of writes once via can_write() and unchecked_byte_writer" )
+{
+#if span_NONSTD_AND( span_FEATURE( BYTE_WRITER ) )
+    unsigned char arr[6] = { 0, };
+    unsigned char const expected[] = { 0x00, 0x01, 0x00, 0x00, 0x00, 0x2a, };
+    span<unsigned char> bytes( arr );
+
+    unchecked_byte_writer writer( bytes );
+
+    if ( writer.can_write( 6 ) )
+    {
+        writer.write<uint16_be>( 1u );
+        writer.write<uint32_be>( 42u );
+    }
+
+    EXPECT( writer.empty() );
+    EXPECT( std::equal( arr, arr + 6, expected ) );
+#else
+    EXPECT( !!"byte_writer is not available (span_FEATURE_BYTE_WRITER=0, or using std::span)" );
+#endif
+}
+
+CASE( "byte_writer: Terminates writing beyond the end" )
+{
+#if span_NONSTD_AND( span_FEATURE( BYTE_WRITER ) )
+    struct F { static void blow() { unsigned char arr[3] = { 0, }; span<unsigned char> bytes( arr ); byte_writer writer( bytes ); writer.write<uint32_le>( 1u ); } };
+
+    EXPECT_THROWS( F::blow() );
+#else
+    EXPECT( !!"byte_writer is not available (span_FEATURE_BYTE_WRITER=0, or using std::span)" );
+#endif
+}
+
+CASE( "spanstream [span_FEATURE_SPANSTREAM=1]" )
+{
+    EXPECT( !!"(avoid warning)" );  // suppress: unused parameter 'lest_env' [-Wunused-parameter]
+}
+
+CASE( "spanstream: Allows to format into a caller-provided buffer via ospanstream" )
+{
+#if span_NONSTD_AND( span_FEATURE( SPANSTREAM ) )
+    char arr[16] = { 0, };
+    ospanstream os( ( span<char>( arr ) ) );
+
+    os << "x=" << 42 << ';';
+
+    span<char> written = os.span();
+
+    EXPECT( os.good() );
+    EXPECT( written.data() == arr );
+    EXPECT( written.size() == 5u );
+    EXPECT( std::string( written.data(), written.size() ) == "x=42;" );
+#else
+    EXPECT( !!"spanstream is not available (span_FEATURE_SPANSTREAM=0, or using std::span)" );
+#endif
+}
+
+CASE( "spanstream: Fails to write beyond the end of the buffer" )
+{
+#if span_NONSTD_AND( span_FEATURE( SPANSTREAM ) )
+    char arr[4] = { 0, };
+    ospanstream os( ( span<char>( arr ) ) );
+
+    os << "12345";
+
+    EXPECT( os.bad() );
+    EXPECT( os.span().size() == 4u );
+    EXPECT( std::string( arr, 4 ) == "1234" );
+#else
+    EXPECT( !!"spanstream is not available (span_FEATURE_SPANSTREAM=0, or using std::span)" );
+#endif
+}
+
+CASE( "spanstream: Allows to parse from a caller-provided buffer via ispanstream" )
+{
+#if span_NONSTD_AND( span_FEATURE( SPANSTREAM ) )
+    char const text[] = "12 34 abc";
+    ispanstream is( span<char const>( text, sizeof text - 1 ) );
+
+    int a = 0, b = 0;
+    std::string c;
+
+    is >> a >> b >> c;
+
+    EXPECT( a == 12 );
+    EXPECT( b == 34 );
+    EXPECT( c == "abc" );
+    EXPECT( is.eof() );
+    EXPECT( is.span().size() == 9u );
+#else
+    EXPECT( !!"spanstream is not available (span_FEATURE_SPANSTREAM=0, or using std::span)" );
+#endif
+}
+
+CASE( "spanstream: Allows to write, seek and read back via spanstream" )
+{
+#if span_NONSTD_AND( span_FEATURE( SPANSTREAM ) )
+    char arr[16] = { 0, };
+    spanstream ios( ( span<char>( arr ) ) );
+
+    int value = 0;
+
+    ios << 1234;
+    ios.seekp( 1 );
+    ios << 9;
+    ios >> value;
+
+    EXPECT( value == 1934 );
+    EXPECT( ios.span().size() == 2u );
+    EXPECT( ios.tellp() == 2 );
+#else
+    EXPECT( !!"spanstream is not available (span_FEATURE_SPANSTREAM=0, or using std::span)" );
+#endif
+}
+
+CASE( "spanstream: Allows to replace the buffer via span(s)" )
+{
+#if span_NONSTD_AND( span_FEATURE( SPANSTREAM ) )
+    char arr1[8] = { 0, };
+    char arr2[8] = { 0, };
+    ospanstream os( ( span<char>( arr1 ) ) );
+
+    os << "ab";
+    os.span( span<char>( arr2 ) );
+    os << "cd";
+
+    EXPECT( os.span().data() == arr2 );
+    EXPECT( std::string( arr1, 2 ) == "ab" );
+    EXPECT( std::string( arr2, 2 ) == "cd" );
+#else
+    EXPECT( !!"spanstream is not available (span_FEATURE_SPANSTREAM=0, or using std::span)" );
+#endif
+}
+
+CASE( "spanstream: Allows to format wide characters via wospanstream" )
+{
+#if span_NONSTD_AND( span_FEATURE( SPANSTREAM ) )
+    wchar_t arr[8] = { 0, };
+    wospanstream os( ( span<wchar_t>( arr ) ) );
+
+    os << L"n=" << 7;
+
+    EXPECT(( std::wstring( os.span().data(), os.span().size() ) == L"n=7" ));
+#else
+    EXPECT( !!"spanstream is not available (span_FEATURE_SPANSTREAM=0, or using std::span)" );
+#endif
+}
+
+CASE( "monotonic_arena [span_FEATURE_MONOTONIC_ARENA=1]" )
+{
+    EXPECT( !!"(avoid warning)" );  // suppress: unused parameter 'lest_env' [-Wunused-parameter]
+}
+
+CASE( "monotonic_arena: Allows to allocate aligned spans from a span of bytes" )
+{
+#if span_NONSTD_AND( span_FEATURE( MONOTONIC_ARENA ) )
+    double storage[8];
+    span<unsigned char> bytes( reinterpret_cast<unsigned char *>( storage ), sizeof storage );
+
+    monotonic_arena arena( bytes );
+
+    span<char>   c = arena.allocate<char>( 3 );
+    span<double> d = arena.allocate<double>( 2 );
+    span<int>    i = arena.allocate<int>( 1 );
+
+    EXPECT( c.size() == 3u );
+    EXPECT( d.size() == 2u );
+    EXPECT( i.size() == 1u );
+    EXPECT( static_cast<void *>( c.data() ) == static_cast<void *>( storage ) );
+    EXPECT( static_cast<void *>( d.data() ) == static_cast<void *>( &storage[1] ) );
+    EXPECT( arena.used() == 3 * sizeof( double ) + sizeof( int ) );
+    EXPECT( arena.capacity() == sizeof storage );
+    EXPECT( arena.available() == sizeof storage - arena.used() );
+#else
+    EXPECT( !!"monotonic_arena is not available (span_FEATURE_MONOTONIC_ARENA=0, or using std::span)" );
+#endif
+}
+
+CASE( "monotonic_arena: Allows to release allocations via mark() and rewind(), or reset()" )
+{
+#if span_NONSTD_AND( span_FEATURE( MONOTONIC_ARENA ) )
+    unsigned char storage[64];
+    span<unsigned char> bytes( storage );
+
+    monotonic_arena arena( bytes );
+
+    span<char> a = arena.allocate<char>( 8 );
+    monotonic_arena::mark_type const m = arena.mark();
+    span<char> b = arena.allocate<char>( 8 );
+
+    arena.rewind( m );
+
+    span<char> c = arena.allocate<char>( 8 );
+
+    EXPECT(( c.data() == b.data() ));
+
+    arena.reset();
+
+    EXPECT( arena.used() == 0u );
+    EXPECT(( arena.allocate<char>( 1 ).data() == a.data() ));
+#else
+    EXPECT( !!"monotonic_arena is not available (span_FEATURE_MONOTONIC_ARENA=0, or using std::span)" );
+#endif
+}
+
+CASE( "monotonic_arena: Reports running out of memory via try_allocate()" )
+{
+#if span_NONSTD_AND( span_FEATURE( MONOTONIC_ARENA ) )
+    unsigned char storage[16];
+    span<unsigned char> bytes( storage );
+
+    monotonic_arena arena( bytes );
+
+    EXPECT( arena.try_allocate<char>( 12 ).size() == 12u );
+    EXPECT(( arena.try_allocate<char>( 5 ).data() == span_nullptr ));
+    EXPECT(( arena.try_allocate<int>( static_cast<size_t>( -1 ) / 2 ).data() == span_nullptr ));
+    EXPECT( arena.used() == 12u );
+#else
+    EXPECT( !!"monotonic_arena is not available (span_FEATURE_MONOTONIC_ARENA=0, or using std::span)" );
+#endif
+}
+
+CASE( "monotonic_arena: Terminates allocate() when out of memory" )
+{
+#if span_NONSTD_AND( span_FEATURE( MONOTONIC_ARENA ) )
+    struct F { static void blow() { unsigned char storage[4]; span<unsigned char> bytes( storage ); monotonic_arena arena( bytes ); arena.allocate<char>( 5 ); } };
+
+    EXPECT_THROWS( F::blow() );
+#else
+    EXPECT( !!"monotonic_arena is not available (span_FEATURE_MONOTONIC_ARENA=0, or using std::span)" );
+#endif
+}
+
+CASE( "monotonic_arena: Allows to fall back to an upstream arena" )
+{
+#if span_NONSTD_AND( span_FEATURE( MONOTONIC_ARENA ) )
+    unsigned char storage1[8];
+    unsigned char storage2[64];
+    span<unsigned char> bytes1( storage1 );
+    span<unsigned char> bytes2( storage2 );
+
+    monotonic_arena upstream( bytes2 );
+    monotonic_arena arena( bytes1, &upstream );
+
+    span<char> a = arena.allocate<char>( 6 );
+    span<char> b = arena.allocate<char>( 6 );
+
+    EXPECT(( a.data() == reinterpret_cast<char *>( storage1 ) ));
+    EXPECT(( b.data() == reinterpret_cast<char *>( storage2 ) ));
+    EXPECT( arena.upstream() == &upstream );
+    EXPECT( upstream.used() == 6u );
+#else
+    EXPECT( !!"monotonic_arena is not available (span_FEATURE_MONOTONIC_ARENA=0, or using std::span)" );
+#endif
+}
+
+CASE( "monotonic_arena: Allows to use an arena as std::pmr::memory_resource (C++17)" )
+{
+#if span_NONSTD_AND( span_FEATURE( MONOTONIC_ARENA ) ) && span_HAVE( MEMORY_RESOURCE )
+    unsigned char storage[256];
+    span<unsigned char> bytes( storage );
+
+    monotonic_arena arena( bytes );
+    monotonic_arena_resource resource( arena );
+
+    std::pmr::vector<int> vec( &resource );
+    vec.push_back( 1 );
+    vec.push_back( 2 );
+
+    EXPECT( arena.used() > 0u );
+    EXPECT( static_cast<void *>( vec.data() ) >= static_cast<void *>( storage ) );
+    EXPECT( static_cast<void *>( vec.data() ) < static_cast<void *>( storage + 256 ) );
+    EXPECT( resource.is_equal( resource ) );
+    EXPECT_THROWS_AS( (void) resource.allocate( 512 ), std::bad_alloc );
+#else
+    EXPECT( !!"monotonic_arena_resource is not available (span_FEATURE_MONOTONIC_ARENA=0, no <memory_resource>, or using std::span)" );
+#endif
+}
+
+CASE( "span_vector<> [span_FEATURE_SPAN_VECTOR=1]" )
+{
+    EXPECT( !!"(avoid warning)" );  // suppress: unused parameter 'lest_env' [-Wunused-parameter]
+}
+
+#if span_NONSTD_AND( span_FEATURE( SPAN_VECTOR ) )
+
+// counts the live objects:
+
+struct Alive
+{
+    static int count;
+    int value;
+
+    Alive( int v = 0 ) : value( v ) { ++count; }
+    Alive( Alive const & other ) : value( other.value ) { ++count; }
+    Alive & operator=( Alive const & other ) { value = other.value; return *this; }
+    ~Alive() { --count; }
+};
+
+int Alive::count = 0;
+
+#endif
+
+CASE( "span_vector<>: Allows to push back elements into a span of objects" )
+{
+#if span_NONSTD_AND( span_FEATURE( SPAN_VECTOR ) )
+    int arr[3] = { 0, };
+    span<int> storage( arr );
+
+    span_vector<int> vec( storage );
+
+    EXPECT( vec.empty() );
+    EXPECT( vec.capacity() == 3u );
+
+    vec.push_back( 1 );
+    vec.push_back( 2 );
+    vec.push_back( 3 );
+
+    EXPECT( vec.full() );
+    EXPECT( vec.size() == 3u );
+    EXPECT( vec.front() == 1 );
+    EXPECT( vec.back()  == 3 );
+    EXPECT( vec[1] == 2 );
+    EXPECT( vec.as_span().data() == arr );
+    EXPECT( vec.as_span().size() == 3u );
+
+    vec.pop_back();
+
+    EXPECT( vec.size() == 2u );
+    EXPECT( *vec.begin() + *( vec.end() - 1 ) == 3 );
+#else
+    EXPECT( !!"span_vector<> is not available (span_FEATURE_SPAN_VECTOR=0, or using std::span)" );
+#endif
+}
+
+CASE( "span_vector<>: Allows to start with the first elements of a span of objects" )
+{
+#if span_NONSTD_AND( span_FEATURE( SPAN_VECTOR ) )
+    int arr[4] = { 1, 2, 0, 0, };
+    span<int> storage( arr );
+
+    span_vector<int> vec( storage, 2 );
+    vec.push_back( 3 );
+
+    EXPECT( vec.size() == 3u );
+    EXPECT( arr[2] == 3 );
+#else
+    EXPECT( !!"span_vector<> is not available (span_FEATURE_SPAN_VECTOR=0, or using std::span)" );
+#endif
+}
+
+CASE( "span_vector<>: Allows to erase elements and to resize" )
+{
+#if span_NONSTD_AND( span_FEATURE( SPAN_VECTOR ) )
+    int arr[8] = { 0, };
+    span<int> storage( arr );
+
+    span_vector<int> vec( storage );
+
+    vec.resize( 5, 7 );
+    vec[0] = 0; vec[1] = 1; vec[2] = 2; vec[3] = 3; vec[4] = 4;
+
+    span_vector<int>::iterator pos = vec.erase( vec.begin() + 1 );
+
+    EXPECT( *pos == 2 );
+    EXPECT( vec.size() == 4u );
+
+    vec.erase( vec.begin() + 1, vec.begin() + 3 );
+
+    EXPECT( vec.size() == 2u );
+    EXPECT( vec[0] == 0 );
+    EXPECT( vec[1] == 4 );
+
+    vec.resize( 4 );
+
+    EXPECT( vec.size() == 4u );
+    EXPECT( vec[3] == 0 );
+
+    vec.clear();
+
+    EXPECT( vec.empty() );
+#else
+    EXPECT( !!"span_vector<> is not available (span_FEATURE_SPAN_VECTOR=0, or using std::span)" );
+#endif
+}
+
+CASE( "span_vector<>: Allows to construct and destroy elements in uninitialized storage" )
+{
+#if span_NONSTD_AND( span_FEATURE( SPAN_VECTOR ) )
+    unsigned char bytes[ 4 * sizeof( Alive ) + sizeof( int ) ];
+    span<unsigned char> storage( bytes );
+
+    Alive::count = 0;
+    {
+        span_vector<Alive> vec( uninitialized_storage, storage );
+
+        EXPECT( vec.capacity() >= 4u );
+        EXPECT( reinterpret_cast<std::size_t>( vec.data() ) % sizeof( int ) == 0u );
+
+        vec.push_back( Alive( 1 ) );
+        vec.push_back( Alive( 2 ) );
+        vec.push_back( Alive( 3 ) );
+
+        EXPECT( Alive::count == 3 );
+
+        vec.erase( vec.begin() );
+
+        EXPECT( Alive::count == 2 );
+        EXPECT( vec.front().value == 2 );
+
+        vec.resize( 3 );
+
+        EXPECT( Alive::count == 3 );
+    }
+    EXPECT( Alive::count == 0 );
+#else
+    EXPECT( !!"span_vector<> is not available (span_FEATURE_SPAN_VECTOR=0, or using std::span)" );
+#endif
+}
+
+CASE( "span_vector<>: Allows to emplace back elements (C++11)" )
+{
+#if span_NONSTD_AND( span_FEATURE( SPAN_VECTOR ) ) && span_CPP11_120
+    unsigned char bytes[ 2 * sizeof( std::pair<int, long> ) + sizeof( long ) ];
+    span<unsigned char> storage( bytes );
+
+    span_vector< std::pair<int, long> > vec( uninitialized_storage, storage );
+
+    vec.emplace_back( 1, 2L );
+
+    EXPECT( vec.back().first  == 1 );
+    EXPECT( vec.back().second == 2L );
+#else
+    EXPECT( !!"span_vector<> is not available (span_FEATURE_SPAN_VECTOR=0, no C++11, or using std::span)" );
+#endif
+}
+
+CASE( "span_vector<>: Terminates push_back() beyond the capacity" )
+{
+#if span_NONSTD_AND( span_FEATURE( SPAN_VECTOR ) )
+    struct F { static void blow() { int arr[1] = { 0, }; span<int> storage( arr ); span_vector<int> vec( storage ); vec.push_back( 1 ); vec.push_back( 2 ); } };
+
+    EXPECT_THROWS( F::blow() );
+#else
+    EXPECT( !!"span_vector<> is not available (span_FEATURE_SPAN_VECTOR=0, or using std::span)" );
+#endif
+}
+
+CASE( "as_span<U>(), as_writable_span<U>() [span_FEATURE_AS_SPAN=1]" )
+{
+    EXPECT( !!"(avoid warning)" );  // suppress: unused parameter 'lest_env' [-Wunused-parameter]
+}
+
+CASE( "as_span<U>(): Allows to view a span of bytes as elements of another type" )
+{
+#if span_NONSTD_AND( span_FEATURE( AS_SPAN ) )
+    int arr[3] = { 1, 2, 3, };
+    span<unsigned char const> bytes( reinterpret_cast<unsigned char const *>( arr ), sizeof( arr ) );
+
+    span<int const> ints = as_span<int>( bytes );
+
+    EXPECT( ints.data() == arr );
+    EXPECT( ints.size() == 3u );
+    EXPECT( ints[2] == 3 );
+#else
+    EXPECT( !!"as_span<U>() is not available (span_FEATURE_AS_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "as_span<U>(): Preserves a static extent" )
+{
+#if span_NONSTD_AND( span_FEATURE( AS_SPAN ) )
+    int arr[2] = { 1, 2, };
+    span<unsigned char const, 2 * sizeof( int )> bytes( reinterpret_cast<unsigned char const *>( arr ), sizeof( arr ) );
+
+    span<int const, 2> ints = as_span<int>( bytes );
+
+    EXPECT( ints.size() == 2u );
+    EXPECT( ( ElementsExtent<int, 2 * sizeof( int )>::value == 2 ) );
+    EXPECT( ( ElementsExtent<int, dynamic_extent>::value == dynamic_extent ) );
+#else
+    EXPECT( !!"as_span<U>() is not available (span_FEATURE_AS_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "as_writable_span<U>(): Allows to change a span of bytes as elements of another type" )
+{
+#if span_NONSTD_AND( span_FEATURE( AS_SPAN ) )
+    int arr[2] = { 0, 0, };
+    span<unsigned char> bytes( reinterpret_cast<unsigned char *>( arr ), sizeof( arr ) );
+
+    span<int> ints = as_writable_span<int>( bytes );
+    ints[1] = 42;
+
+    EXPECT( ints.size() == 2u );
+    EXPECT( arr[1] == 42 );
+#else
+    EXPECT( !!"as_writable_span<U>() is not available (span_FEATURE_AS_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "as_span<U>(): Terminates for misaligned data" )
+{
+#if span_NONSTD_AND( span_FEATURE( AS_SPAN ) )
+    struct F { static void blow() { int arr[2] = { 0, 0, }; span<unsigned char const> bytes( reinterpret_cast<unsigned char const *>( arr ) + 1, sizeof( int ) ); (void) as_span<int>( bytes ); } };
+
+    EXPECT_THROWS( F::blow() );
+#else
+    EXPECT( !!"as_span<U>() is not available (span_FEATURE_AS_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "as_writable_span<U>(): Terminates for a size that is not a multiple of sizeof(U)" )
+{
+#if span_NONSTD_AND( span_FEATURE( AS_SPAN ) )
+    struct F { static void blow() { int arr[2] = { 0, 0, }; span<unsigned char> bytes( reinterpret_cast<unsigned char *>( arr ), sizeof( int ) + 1 ); (void) as_writable_span<int>( bytes ); } };
+
+    EXPECT_THROWS( F::blow() );
+#else
+    EXPECT( !!"as_writable_span<U>() is not available (span_FEATURE_AS_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "unaligned_span<> [span_FEATURE_UNALIGNED_SPAN=1]" )
+{
+    EXPECT( !!"(avoid warning)" );  // suppress: unused parameter 'lest_env' [-Wunused-parameter]
+}
+
+CASE( "unaligned_span<>: Allows to read values at any address in the byte order of the platform" )
+{
+#if span_NONSTD_AND( span_FEATURE( UNALIGNED_SPAN ) )
+    int const values[2] = { 0x01020304, -42, };
+    unsigned char buffer[ 1 + sizeof( values ) ] = { 0, };
+
+    for ( size_t i = 0; i < sizeof( values ); ++i )
+    {
+        buffer[ 1 + i ] = reinterpret_cast< unsigned char const * >( values )[ i ];
+    }
+
+    span<unsigned char const> bytes( buffer + 1, sizeof( values ) );
+    unaligned_span<int const> ints( bytes );
+
+    EXPECT( ints.size() == 2u );
+    EXPECT( ints.size_bytes() == sizeof( values ) );
+    EXPECT( ints[0] == values[0] );
+    EXPECT( ints[1] == values[1] );
+    EXPECT( ints.load( 1 ) == values[1] );
+    EXPECT( *ints.begin() == values[0] );
+    EXPECT( ints.end() - ints.begin() == 2 );
+    EXPECT( ints.end()[-1] == values[1] );
+#else
+    EXPECT( !!"unaligned_span<> is not available (span_FEATURE_UNALIGNED_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "unaligned_span<>: Allows to read values of a given byte order" )
+{
+#if span_NONSTD_AND( span_FEATURE( UNALIGNED_SPAN ) )
+    typedef uint32_be::value_type type;
+    unsigned char buffer[] = { 0xff, 0x12, 0x34, 0x56, 0x78, 0x00, 0x00, 0x01, 0x00, };
+
+    span<unsigned char const> bytes( buffer + 1, 8 );
+    unaligned_span<type const, uint32_be> ints( bytes );
+
+    EXPECT( ints[0] == 0x12345678u );
+    EXPECT( ints[1] == 0x00000100u );
+#else
+    EXPECT( !!"unaligned_span<> is not available (span_FEATURE_UNALIGNED_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "unaligned_span<>: Allows to change values at any address" )
+{
+#if span_NONSTD_AND( span_FEATURE( UNALIGNED_SPAN ) )
+    typedef uint16_le::value_type type;
+    unsigned char buffer[5] = { 0, };
+
+    span<unsigned char> bytes( buffer + 1, 4 );
+    unaligned_span<type, uint16_le> shorts( bytes );
+
+    shorts[0] = 0x0102;
+    shorts.store( 1, 0x0304 );
+
+    EXPECT( buffer[0] == 0x00 );
+    EXPECT( buffer[1] == 0x02 );
+    EXPECT( buffer[2] == 0x01 );
+    EXPECT( buffer[3] == 0x04 );
+    EXPECT( buffer[4] == 0x03 );
+
+    *shorts.begin() = shorts[1];
+
+    EXPECT( shorts[0] == 0x0304 );
+
+    unaligned_span<type, uint16_le>::reference ref( shorts[1] );
+    ref = 0x0506;
+
+    EXPECT( shorts[1] == 0x0506 );
+#else
+    EXPECT( !!"unaligned_span<> is not available (span_FEATURE_UNALIGNED_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "unaligned_span<>: Allows to copy all values to and from a span of values" )
+{
+#if span_NONSTD_AND( span_FEATURE( UNALIGNED_SPAN ) )
+    typedef uint32_be::value_type type;
+    unsigned char buffer[ 1 + 3 * 4 ] = { 0, };
+    type const in[3] = { 1, 0x01020304u, 3, };
+    type out[3] = { 0, };
+    type native[3] = { 0, };
+
+    span<unsigned char> bytes( buffer + 1, 3 * 4 );
+    unaligned_span<type, uint32_be> big( bytes );
+    unaligned_span<type> natural( bytes );
+
+    big.copy_from( span<type const>( in ) );
+    big.copy_to( span<type>( out ) );
+
+    EXPECT( buffer[5] == 0x01 );
+    EXPECT( buffer[8] == 0x04 );
+    EXPECT( out[0] == in[0] );
+    EXPECT( out[1] == in[1] );
+    EXPECT( out[2] == in[2] );
+
+    natural.copy_from( span<type const>( in ) );
+    natural.copy_to( span<type>( native ) );
+
+    EXPECT( native[0] == in[0] );
+    EXPECT( native[1] == in[1] );
+    EXPECT( native[2] == in[2] );
+#else
+    EXPECT( !!"unaligned_span<> is not available (span_FEATURE_UNALIGNED_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "unaligned_span<>: Allows to copy an empty view to and from an empty span of values" )
+{
+#if span_NONSTD_AND( span_FEATURE( UNALIGNED_SPAN ) )
+    typedef uint32_be::value_type type;
+
+    unaligned_span<type> natural;
+    unaligned_span<type, uint32_be> big;
+
+    natural.copy_from( span<type const>() );
+    natural.copy_to( span<type>() );
+    big.copy_from( span<type const>() );
+    big.copy_to( span<type>() );
+
+    EXPECT( natural.size() == 0u );
+    EXPECT( big.size() == 0u );
+#else
+    EXPECT( !!"unaligned_span<> is not available (span_FEATURE_UNALIGNED_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "unaligned_span<>: Allows to view the first, last and a sub range of values" )
+{
+#if span_NONSTD_AND( span_FEATURE( UNALIGNED_SPAN ) )
+    typedef uint16_be::value_type type;
+    unsigned char buffer[] = { 0, 1, 0, 2, 0, 3, 0, 4, };
+
+    span<unsigned char const> bytes( buffer );
+    unaligned_span<type const, uint16_be> shorts( bytes );
+
+    EXPECT( shorts.first( 1 )[0] == 1 );
+    EXPECT( shorts.last( 1 )[0] == 4 );
+    EXPECT( shorts.subspan( 1 ).size() == 3u );
+    EXPECT( shorts.subspan( 1, 2 )[1] == 3 );
+    EXPECT( shorts.subspan( 4 ).empty() );
+    EXPECT(( shorts.bytes().data() == reinterpret_cast<unaligned_span<type const>::byte_type const *>( buffer ) ));
+    EXPECT( shorts.bytes().size() == 8u );
+#else
+    EXPECT( !!"unaligned_span<> is not available (span_FEATURE_UNALIGNED_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "unaligned_span<>: Terminates construction from a size that is not a multiple of sizeof(T)" )
+{
+#if span_NONSTD_AND( span_FEATURE( UNALIGNED_SPAN ) )
+    struct F { static void blow() { unsigned char buffer[5] = { 0, }; span<unsigned char const> bytes( buffer ); unaligned_span<int const> ints( bytes ); } };
+
+    EXPECT_THROWS( F::blow() );
+#else
+    EXPECT( !!"unaligned_span<> is not available (span_FEATURE_UNALIGNED_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "unaligned_span<>: Terminates access outside the values" )
+{
+#if span_NONSTD_AND( span_FEATURE( UNALIGNED_SPAN ) )
+    struct F { static void blow() { unsigned char buffer[4] = { 0, }; span<unsigned char const> bytes( buffer ); unaligned_span<short const> shorts( bytes ); (void) shorts[2]; } };
+
+    EXPECT_THROWS( F::blow() );
+#else
+    EXPECT( !!"unaligned_span<> is not available (span_FEATURE_UNALIGNED_SPAN=0, or using std::span)" );
+#endif
+}
+
+CASE( "chunks(), windows(), chunks_exact<>() [span_FEATURE_CHUNKS=1]" )
+{
+    EXPECT( !!"(avoid warning)" );  // suppress: unused parameter 'lest_env' [-Wunused-parameter]
+}
+
+CASE( "chunks(): Terminates creation with a zero chunk size" )
+{
+#if span_NONSTD_AND( span_FEATURE( CHUNKS ) )
+    struct F { static void blow() { int arr[] = { 1, 2, 3, }; (void) chunks( span<int>( arr ), 0 ); } };
+
+    EXPECT_THROWS( F::blow() );
+#else
+    EXPECT( !!"chunks() is not available (span_FEATURE_CHUNKS=0, or using std::span)" );
+#endif
+}
+
+CASE( "chunks(): Allows to iterate over consecutive sub spans with a shorter last one" )
+{
+#if span_NONSTD_AND( span_FEATURE( CHUNKS ) )
+    int arr[] = { 1, 2, 3, 4, 5, 6, 7, };
+
+    chunk_view<int> v = chunks( span<int>( arr ), 3 );
+
+    EXPECT( v.size() == size_type( 3 ) );
+    EXPECT( v[0].size() == size_type( 3 ) );
+    EXPECT( v[2].size() == size_type( 1 ) );
+    EXPECT( v[1].data() == &arr[3] );
+    EXPECT( v[2][0] == 7 );
+    EXPECT( v.remainder().empty() );
+
+    int sum = 0;
+    for ( chunk_view<int>::iterator pos = v.begin(); pos != v.end(); ++pos )
+    {
+        sum += (*pos)[0];
+    }
+    EXPECT( sum == 1 + 4 + 7 );
+    EXPECT( v.end() - v.begin() == 3 );
+#else
+    EXPECT( !!"chunks() is not available (span_FEATURE_CHUNKS=0, or using std::span)" );
+#endif
+}
+
+CASE( "chunks(): Allows a chunk size near the maximum size" )
+{
+#if span_NONSTD_AND( span_FEATURE( CHUNKS ) )
+    int arr[] = { 1, 2, 3, };
+
+    chunk_view<int> v = chunks( span<int>( arr ), std::size_t( -1 ) );
+
+    EXPECT( v.size() == size_type( 1 ) );
+    EXPECT( v[0].size() == size_type( 3 ) );
+#else
+    EXPECT( !!"chunks() is not available (span_FEATURE_CHUNKS=0, or using std::span)" );
+#endif
+}
+
+CASE( "chunk_iterator: Allows random access via comparison, n + it and ->" )
+{
+#if span_NONSTD_AND( span_FEATURE( CHUNKS ) )
+    int arr[] = { 1, 2, 3, 4, 5, 6, 7, };
+
+    chunk_view<int> v = chunks( span<int>( arr ), 3 );
+    chunk_view<int>::iterator first = v.begin();
+    chunk_view<int>::iterator last  = v.end();
+
+    EXPECT(( first <  last ));
+    EXPECT(( first <= first ));
+    EXPECT(( last  >  first ));
+    EXPECT(( last  >= last ));
+    EXPECT(( 3 + first == last ));
+    EXPECT( first->size() == size_type( 3 ) );
+    EXPECT( ( 2 + first )->size() == size_type( 1 ) );
+#else
+    EXPECT( !!"chunks() is not available (span_FEATURE_CHUNKS=0, or using std::span)" );
+#endif
+}
+
+CASE( "windows(): Allows to iterate over overlapping sub spans" )
+{
+#if span_NONSTD_AND( span_FEATURE( CHUNKS ) )
+    int arr[] = { 1, 2, 3, 4, 5, };
+
+    chunk_view<int> v = windows( span<int>( arr ), 3 );
+
+    EXPECT( v.size() == size_type( 3 ) );
+    EXPECT( v[0].data() == &arr[0] );
+    EXPECT( v[2].data() == &arr[2] );
+    EXPECT( v[2].size() == size_type( 3 ) );
+    EXPECT( v.remainder().empty() );
+    EXPECT( windows( span<int>( arr ), 6 ).empty() );
+
+    int sum = 0;
+    for ( chunk_view<int>::iterator pos = v.begin(); pos != v.end(); ++pos )
+    {
+        sum += (*pos)[2];
+    }
+    EXPECT( sum == 3 + 4 + 5 );
+#else
+    EXPECT( !!"windows() is not available (span_FEATURE_CHUNKS=0, or using std::span)" );
+#endif
+}
+
+CASE( "chunks_exact<>(): Allows to iterate over sub spans of static extent and to obtain the remainder" )
+{
+#if span_NONSTD_AND( span_FEATURE( CHUNKS ) )
+    int arr[] = { 1, 2, 3, 4, 5, 6, 7, };
+
+    chunk_view<int, 2> v = chunks_exact<2>( span<int>( arr ) );
+    span<int, 2> c = v[1];
+
+    EXPECT( v.size() == size_type( 3 ) );
+    EXPECT( c.data() == &arr[2] );
+    EXPECT( c.size() == size_type( 2 ) );
+    EXPECT( v.remainder().size() == size_type( 1 ) );
+    EXPECT( v.remainder()[0] == 7 );
+
+    int sum = 0;
+    for ( chunk_view<int, 2>::iterator pos = v.begin(); pos != v.end(); ++pos )
+    {
+        sum += (*pos)[1];
+    }
+    EXPECT( sum == 2 + 4 + 6 );
+#else
+    EXPECT( !!"chunks_exact<>() is not available (span_FEATURE_CHUNKS=0, or using std::span)" );
+#endif
+}
+
+CASE( "chunks(), windows(), chunks_exact<>(): Allows range-for over the sub spans (C++11)" )
+{
+#if span_NONSTD_AND( span_FEATURE( CHUNKS ) ) && span_CPP11_OR_GREATER
+    int arr[] = { 1, 2, 3, 4, 5, 6, };
+
+    int sum = 0;
+    for ( span<int, 3> c : chunks_exact<3>( span<int>( arr ) ) )
+    {
+        sum += c[0] * c[1] * c[2];
+    }
+    EXPECT( sum == 6 + 120 );
+
+    size_type n = 0;
+    for ( span<int> w : windows( span<int>( arr ), 2 ) )
+    {
+        n += w.size();
+    }
+    EXPECT( n == size_type( 10 ) );
+#else
+    EXPECT( !!"chunks() is not available (span_FEATURE_CHUNKS=0, no C++11, or using std::span)" );
+#endif
+}
+
+CASE( "mdspan<> [span_FEATURE_MDSPAN=1]" )
+{
+    EXPECT( !!"(avoid warning)" );  // suppress: unused parameter 'lest_env' [-Wunused-parameter]
+}
+
+CASE( "mdspan<>: Terminates construction from a span that is too small" )
+{
+#if span_NONSTD_AND( span_FEATURE( MDSPAN ) ) && span_CPP11_120
+    struct F { static void blow() { int arr[] = { 1, 2, 3, 4, 5, }; mdspan<int, extents<2, dynamic_extent> > m( span<int>( arr ), 3 ); } };
+
+    EXPECT_THROWS( F::blow() );
+#else
+    EXPECT( !!"mdspan<> is not available (span_FEATURE_MDSPAN=0, no C++11, or using std::span)" );
+#endif
+}
+
+CASE( "mdspan<>: Terminates access outside the extents" )
+{
+#if span_NONSTD_AND( span_FEATURE( MDSPAN ) ) && span_CPP11_120
+    struct F {
+        static void blow_ix( int i, int j ) { int arr[] = { 1, 2, 3, 4, 5, 6, }; mdspan<int, extents<2, 3> > m( arr ); (void) m( i, j ); }
+    };
+
+    EXPECT_NO_THROW( F::blow_ix( 1, 2 ) );
+    EXPECT_THROWS(   F::blow_ix( 2, 0 ) );
+    EXPECT_THROWS(   F::blow_ix( 0, 3 ) );
+    EXPECT_THROWS(   F::blow_ix( -1, 0 ) );
+#else
+    EXPECT( !!"mdspan<> is not available (span_FEATURE_MDSPAN=0, no C++11, or using std::span)" );
+#endif
+}
+
+CASE( "mdspan<>: Allows to obtain static and dynamic extents via extents<>" )
+{
+#if span_NONSTD_AND( span_FEATURE( MDSPAN ) ) && span_CPP11_120
+    typedef extents<2, dynamic_extent, 4> ext_type;
+
+    ext_type e( 3 );
+
+    EXPECT( ext_type::rank()         == 3u );
+    EXPECT( ext_type::rank_dynamic() == 1u );
+    EXPECT( ext_type::static_extent( 0 ) == 2 );
+    EXPECT( ext_type::static_extent( 1 ) == dynamic_extent );
+    EXPECT( e.extent<1>() == size_type( 3 ) );
+    EXPECT( e.extent( 2 ) == size_type( 4 ) );
+    EXPECT( e.size()      == size_type( 24 ) );
+#else
+    EXPECT( !!"mdspan<> is not available (span_FEATURE_MDSPAN=0, no C++11, or using std::span)" );
+#endif
+}
+
+CASE( "mdspan<>: Allows fully static extents<> without storage" )
+{
+#if span_NONSTD_AND( span_FEATURE( MDSPAN ) ) && span_CPP11_120
+    typedef extents<2, 3> ext_type;
+
+    ext_type e;
+
+    EXPECT( std::is_empty< ext_type >::value );
+    EXPECT( e.extent<0>() == size_type( 2 ) );
+    EXPECT( e.extent( 1 ) == size_type( 3 ) );
+    EXPECT( e.size()      == size_type( 6 ) );
+#else
+    EXPECT( !!"mdspan<> is not available (span_FEATURE_MDSPAN=0, no C++11, or using std::span)" );
+#endif
+}
+
+CASE( "mdspan<>: Allows to access elements in row-major order (layout_right)" )
+{
+#if span_NONSTD_AND( span_FEATURE( MDSPAN ) ) && span_CPP11_120
+    int arr[] = { 1, 2, 3, 4, 5, 6, };
+
+    mdspan<int, extents<dynamic_extent, dynamic_extent> > m( arr, 2, 3 );
+
+    EXPECT( m.rank()      == 2u );
+    EXPECT( m.extent( 0 ) == size_type( 2 ) );
+    EXPECT( m.extent( 1 ) == size_type( 3 ) );
+    EXPECT( m.size()      == size_type( 6 ) );
+    EXPECT( m.stride( 0 ) == size_type( 3 ) );
+    EXPECT( m.stride( 1 ) == size_type( 1 ) );
+    EXPECT( m( 0, 2 ) == 3 );
+    EXPECT( m( 1, 0 ) == 4 );
+    EXPECT( m( 1, 2 ) == 6 );
+#else
+    EXPECT( !!"mdspan<> is not available (span_FEATURE_MDSPAN=0, no C++11, or using std::span)" );
+#endif
+}
+
+CASE( "mdspan<>: Allows to access elements in column-major order (layout_left)" )
+{
+#if span_NONSTD_AND( span_FEATURE( MDSPAN ) ) && span_CPP11_120
+    int arr[] = { 1, 2, 3, 4, 5, 6, };
+
+    mdspan<int, extents<2, 3>, layout_left> m( arr );
+
+    EXPECT( m.stride( 0 ) == size_type( 1 ) );
+    EXPECT( m.stride( 1 ) == size_type( 2 ) );
+    EXPECT( m( 1, 0 ) == 2 );
+    EXPECT( m( 0, 2 ) == 5 );
+    EXPECT( m( 1, 2 ) == 6 );
+#else
+    EXPECT( !!"mdspan<> is not available (span_FEATURE_MDSPAN=0, no C++11, or using std::span)" );
+#endif
+}
+
+CASE( "mdspan<>: Allows to access elements with user-specified strides (layout_stride)" )
+{
+#if span_NONSTD_AND( span_FEATURE( MDSPAN ) ) && span_CPP11_120
+    int arr[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, };
+
+    typedef extents<2, 2> ext_type;
+    typedef layout_stride::mapping<ext_type> map_type;
+
+    map_type::strides_type strides = {{ 6, 2 }};
+
+    mdspan<int, ext_type, layout_stride> m( span<int>( arr ), map_type( ext_type(), strides ) );
+
+    EXPECT( m.mapping().required_span_size() == size_type( 9 ) );
+    EXPECT( m( 0, 1 ) ==  3 );
+    EXPECT( m( 1, 0 ) ==  7 );
+    EXPECT( m( 1, 1 ) ==  9 );
+#else
+    EXPECT( !!"mdspan<> is not available (span_FEATURE_MDSPAN=0, no C++11, or using std::span)" );
+#endif
+}
+
+CASE( "mdspan<>: Allows to construct from a span and obtain the viewed elements as a span" )
+{
+#if span_NONSTD_AND( span_FEATURE( MDSPAN ) ) && span_CPP11_120
+    int arr[] = { 1, 2, 3, 4, 5, 6, 7, };
+
+#if span_HAVE( ALIAS_TEMPLATE )
+    mdspan<int, dextents<3> > m( span<int>( arr ), 1, 2, 3 );
+#else
+    mdspan<int, extents<dynamic_extent, dynamic_extent, dynamic_extent> > m( span<int>( arr ), 1, 2, 3 );
+#endif
+    m( 0, 1, 1 ) = 42;
+
+    EXPECT( m.rank_dynamic() == 3u );
+    EXPECT( m.data_handle()  == &arr[0] );
+    EXPECT( m.to_span().size() == size_type( 6 ) );
+    EXPECT( arr[4] == 42 );
+#else
+    EXPECT( !!"mdspan<> is not available (span_FEATURE_MDSPAN=0, no C++11, or using std::span)" );
+#endif
+}
+
 // Issues
 
 #include <cassert>
@@ -2139,6 +5004,7 @@ CASE( "[hide][issue-3: same()]" )
     static float      const farray[4] = { 0, 1, 2, 3 };
 
     span<float const> fspan1 = make_span( farray );
+    (void) fspan1;  // suppress with NDEBUG: variable set but not used [-Wunused-but-set-variable]
 
     assert( fspan1.data() == farray );
     assert( fspan1.size() == static_cast<size_type>( DIMENSION_OF( farray ) ) );
@@ -2152,6 +5018,7 @@ CASE( "[hide][issue-3: same()]" )
 # endif
 
     span<uint8_type const> bspan4 = make_span( &data[0], 4 );
+    (void) bspan4;  // suppress with NDEBUG: variable set but not used [-Wunused-but-set-variable]
 
     assert(        bspan4 == fspan1   );
     assert(        fspan1 == bspan4   );
@@ -2172,6 +5039,7 @@ CASE( "[hide][issue-3: same()]" )
     span<int  > uspan1 = make_span( &u.i, 1 );
     span<float> uspan2 = make_span( &u.f, 1 );
     span<char > uspan3 = make_span( &u.c, 1 );
+    (void) uspan1; (void) uspan2; (void) uspan3;  // suppress with NDEBUG: variables set but not used [-Wunused-but-set-variable]
 
     assert( static_cast<void const *>( uspan1.data() ) == uspan2.data() );
     assert(                            uspan1.size()   == uspan2.size() );
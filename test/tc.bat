@@ -44,7 +44,25 @@ set unit_config=^
     -Dspan_FEATURE_NON_MEMBER_FIRST_LAST_SUB_SPAN=1 ^
     -Dspan_FEATURE_NON_MEMBER_FIRST_LAST_SUB_CONTAINER=1 ^
     -Dspan_FEATURE_MAKE_SPAN_TO_STD=99 ^
-    -Dspan_FEATURE_BYTE_SPAN=1
+    -Dspan_FEATURE_BYTE_SPAN=1 ^
+    -Dspan_FEATURE_STRIDED_SPAN=1 ^
+    -Dspan_FEATURE_MDSPAN=1 ^
+    -Dspan_FEATURE_CHUNKS=1 ^
+    -Dspan_FEATURE_HASH=1 ^
+    -Dspan_FEATURE_UNCHECKED_ACCESS=1 ^
+    -Dspan_FEATURE_ALIGNED_SPAN=1 ^
+    -Dspan_FEATURE_NOALIAS_SPAN=1 ^
+    -Dspan_FEATURE_BIT_SPAN=1 ^
+    -Dspan_FEATURE_RING_VIEW=1 ^
+    -Dspan_FEATURE_SPAN_LIST=1 ^
+    -Dspan_FEATURE_MAPPED_FILE=1 ^
+    -Dspan_FEATURE_BYTE_READER=1 ^
+    -Dspan_FEATURE_BYTE_WRITER=1 ^
+    -Dspan_FEATURE_SPANSTREAM=1 ^
+    -Dspan_FEATURE_MONOTONIC_ARENA=1 ^
+    -Dspan_FEATURE_SPAN_VECTOR=1 ^
+    -Dspan_FEATURE_AS_SPAN=1 ^
+    -Dspan_FEATURE_UNALIGNED_SPAN=1
 
 set byte_lite=^
     -Dspan_BYTE_LITE_HEADER=\"../../byte-lite/include/nonstd/byte.hpp\"